@@ -0,0 +1,162 @@
+# Generates bloom_filter.parquet: a file with split-block Bloom filters for every column chunk, but without min/max
+# statistics, so that row groups can only be skipped by probing the Bloom filters.
+# Row group k contains the even numbers i in [2000 * k, 2000 * (k + 1)) and the strings 'str' || i.
+import struct
+
+# xxHash64
+P1 = 11400714785074694791
+P2 = 14029467366897019727
+P3 = 1609587929392839161
+P4 = 9650029242287828579
+P5 = 2870177450012600261
+M = (1 << 64) - 1
+
+
+def rotl(x, r):
+    return ((x << r) | (x >> (64 - r))) & M
+
+
+def xxh64_round(acc, lane):
+    acc = (acc + lane * P2) & M
+    return (rotl(acc, 31) * P1) & M
+
+
+def xxh64(data, seed=0):
+    length = len(data)
+    i = 0
+    if length >= 32:
+        v = [(seed + P1 + P2) & M, (seed + P2) & M, seed, (seed - P1) & M]
+        while i + 32 <= length:
+            for k in range(4):
+                v[k] = xxh64_round(v[k], struct.unpack_from('<Q', data, i + 8 * k)[0])
+            i += 32
+        h = (rotl(v[0], 1) + rotl(v[1], 7) + rotl(v[2], 12) + rotl(v[3], 18)) & M
+        for k in range(4):
+            h = ((h ^ xxh64_round(0, v[k])) * P1 + P4) & M
+    else:
+        h = (seed + P5) & M
+    h = (h + length) & M
+    while i + 8 <= length:
+        h ^= xxh64_round(0, struct.unpack_from('<Q', data, i)[0])
+        h = (rotl(h, 27) * P1 + P4) & M
+        i += 8
+    if i + 4 <= length:
+        h ^= (struct.unpack_from('<I', data, i)[0] * P1) & M
+        h = (rotl(h, 23) * P2 + P3) & M
+        i += 4
+    while i < length:
+        h ^= (data[i] * P5) & M
+        h = (rotl(h, 11) * P1) & M
+        i += 1
+    h ^= h >> 33
+    h = (h * P2) & M
+    h ^= h >> 29
+    h = (h * P3) & M
+    h ^= h >> 32
+    return h
+
+
+# split-block Bloom filter
+SALT = [0x47B6137B, 0x44974D91, 0x8824AD5B, 0xA2B7289D, 0x705495C7, 0x2DF1424B, 0x9EFC4947, 0x5C6BFB31]
+
+
+def bloom_filter(hashes, num_blocks):
+    words = [0] * (8 * num_blocks)
+    for h in hashes:
+        block = ((h >> 32) * num_blocks) >> 32
+        key = h & 0xFFFFFFFF
+        for k in range(8):
+            y = (key * SALT[k]) & 0xFFFFFFFF
+            words[8 * block + k] |= 1 << (y >> 27)
+    return struct.pack('<%dI' % len(words), *words)
+
+
+# thrift compact protocol
+def varint(n):
+    out = bytearray()
+    while True:
+        if n < 0x80:
+            out.append(n)
+            return bytes(out)
+        out.append((n & 0x7F) | 0x80)
+        n >>= 7
+
+
+def zigzag(n):
+    return (n << 1) ^ (n >> 63)
+
+
+I32, I64, BINARY, LIST, STRUCT = 5, 6, 8, 9, 12
+
+
+def encode_value(ftype, value):
+    if ftype in (I32, I64):
+        return varint(zigzag(value))
+    if ftype == BINARY:
+        return varint(len(value)) + value
+    if ftype == STRUCT:
+        return encode_struct(value)
+    if ftype == LIST:
+        etype, elements = value
+        header = bytes([(len(elements) << 4) | etype]) if len(elements) < 15 else bytes([0xF0 | etype]) + varint(
+            len(elements))
+        return header + b''.join(encode_value(etype, e) for e in elements)
+    raise Exception('unsupported type')
+
+
+def encode_struct(fields):
+    out = bytearray()
+    last = 0
+    for fid, ftype, value in fields:
+        assert 0 < fid - last <= 15
+        out.append(((fid - last) << 4) | ftype)
+        out += encode_value(ftype, value)
+        last = fid
+    out.append(0)
+    return bytes(out)
+
+
+ROW_GROUPS = 3
+ROWS_PER_GROUP = 1000
+BLOOM_BLOCKS = 128
+
+columns = [('i', 2, None), ('s', 6, 0)]  # (name, physical type, converted type): INT64 and BYTE_ARRAY (UTF8)
+file = bytearray(b'PAR1')
+row_groups = []
+for rg in range(ROW_GROUPS):
+    values = [2 * (rg * ROWS_PER_GROUP + j) for j in range(ROWS_PER_GROUP)]
+    chunks = []
+    for name, ptype, _ in columns:
+        if ptype == 2:
+            plain = [struct.pack('<q', v) for v in values]
+            page = b''.join(plain)
+        else:
+            plain = [('str%d' % v).encode() for v in values]
+            page = b''.join(struct.pack('<I', len(p)) + p for p in plain)
+        header = encode_struct([(1, I32, 0), (2, I32, len(page)), (3, I32, len(page)),
+                                (5, STRUCT, [(1, I32, ROWS_PER_GROUP), (2, I32, 0), (3, I32, 3), (4, I32, 3)])])
+        data_page_offset = len(file)
+        file += header + page
+        chunk_size = len(header) + len(page)
+        bitset = bloom_filter([xxh64(p) for p in plain], BLOOM_BLOCKS)
+        bloom_header = encode_struct([(1, I32, len(bitset)), (2, STRUCT, [(1, STRUCT, [])]),
+                                      (3, STRUCT, [(1, STRUCT, [])]), (4, STRUCT, [(1, STRUCT, [])])])
+        bloom_filter_offset = len(file)
+        file += bloom_header + bitset
+        meta = [(1, I32, ptype), (2, LIST, (I32, [0])), (3, LIST, (BINARY, [name.encode()])), (4, I32, 0),
+                (5, I64, ROWS_PER_GROUP), (6, I64, chunk_size), (7, I64, chunk_size), (9, I64, data_page_offset),
+                (14, I64, bloom_filter_offset), (15, I32, len(bloom_header) + len(bitset))]
+        chunks.append([(2, I64, data_page_offset), (3, STRUCT, meta)])
+    row_groups.append([(1, LIST, (STRUCT, chunks)), (2, I64, 0), (3, I64, ROWS_PER_GROUP)])
+
+schema = [[(4, BINARY, b'schema'), (5, I32, len(columns))]]
+for name, ptype, converted in columns:
+    element = [(1, I32, ptype), (3, I32, 0), (4, BINARY, name.encode())]
+    if converted is not None:
+        element.append((6, I32, converted))
+    schema.append(element)
+footer = encode_struct([(1, I32, 1), (2, LIST, (STRUCT, schema)), (3, I64, ROW_GROUPS * ROWS_PER_GROUP),
+                        (4, LIST, (STRUCT, row_groups))])
+file += footer + struct.pack('<I', len(footer)) + b'PAR1'
+with open('bloom_filter.parquet', 'wb') as f:
+    f.write(file)
@@ -3,6 +3,7 @@
 #include "duckdb.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
+#include "parquet_statistics.hpp"
 #include "parquet_writer.hpp"
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/common.hpp"
@@ -31,6 +32,7 @@ namespace duckdb {
 using namespace duckdb_parquet; // NOLINT
 using namespace duckdb_miniz;   // NOLINT
 
+using duckdb_parquet::format::BloomFilterHeader;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
@@ -339,6 +341,8 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+	//! The hashes of the written values, used to build the Bloom filter of the column chunk (if any)
+	vector<uint64_t> bloom_filter_hashes;
 };
 
 //===--------------------------------------------------------------------===//
@@ -349,7 +353,8 @@ class BasicColumnWriter : public ColumnWriter {
 public:
 	BasicColumnWriter(ParquetWriter &writer, idx_t schema_idx, vector<string> schema_path, idx_t max_repeat,
 	                  idx_t max_define, bool can_have_nulls)
-	    : ColumnWriter(writer, schema_idx, std::move(schema_path), max_repeat, max_define, can_have_nulls) {
+	    : ColumnWriter(writer, schema_idx, std::move(schema_path), max_repeat, max_define, can_have_nulls),
+	      write_bloom_filter(writer.HasBloomFilter(this->schema_path)) {
 	}
 
 	~BasicColumnWriter() override = default;
@@ -405,8 +410,20 @@ protected:
 	void WriteDictionary(BasicColumnWriterState &state, unique_ptr<MemoryStream> temp_writer, idx_t row_count);
 	virtual void FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats);
 
+	//! Whether or not a Bloom filter is written for the column chunks of this column
+	virtual bool HasBloomFilter() {
+		return false;
+	}
+	//! Adds the hashes of the values in a (subset of a) vector to the Bloom filter. Only used for scalar types.
+	virtual void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start, idx_t chunk_end);
+	void WriteBloomFilter(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column_chunk);
+
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
+
+protected:
+	//! Whether or not the Bloom filter of this column was requested (if the type supports it)
+	bool write_bloom_filter;
 };
 
 unique_ptr<ColumnWriterState> BasicColumnWriter::InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) {
@@ -612,6 +629,9 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 
 		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
 		            offset + write_count);
+		if (HasBloomFilter()) {
+			UpdateBloomFilter(state, vector, offset, offset + write_count);
+		}
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -700,6 +720,44 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	if (HasBloomFilter()) {
+		WriteBloomFilter(state, column_chunk);
+	}
+}
+
+void BasicColumnWriter::UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start,
+                                          idx_t chunk_end) {
+	throw InternalException("This column writer does not support Bloom filters");
+}
+
+void BasicColumnWriter::WriteBloomFilter(BasicColumnWriterState &state,
+                                         duckdb_parquet::format::ColumnChunk &column_chunk) {
+	// size the filter for the amount of distinct values in the column chunk
+	auto &hashes = state.bloom_filter_hashes;
+	std::sort(hashes.begin(), hashes.end());
+	hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+	ParquetBloomFilter bloom_filter(Allocator::DefaultAllocator(), hashes.size(), writer.BloomFilterFPP());
+	for (auto &hash : hashes) {
+		bloom_filter.FilterInsert(hash);
+	}
+	hashes.clear();
+
+	// the Bloom filter is written directly after the pages of the column chunk
+	auto &bitset = bloom_filter.Get();
+	BloomFilterHeader header;
+	header.numBytes = NumericCast<int32_t>(bitset.len);
+	header.algorithm.__set_BLOCK(duckdb_parquet::format::SplitBlockAlgorithm());
+	header.hash.__set_XXHASH(duckdb_parquet::format::XxHash());
+	header.compression.__set_UNCOMPRESSED(duckdb_parquet::format::Uncompressed());
+
+	auto &column_writer = writer.GetWriter();
+	auto bloom_filter_offset = column_writer.GetTotalWritten();
+	writer.Write(header);
+	writer.WriteData(bitset.ptr, NumericCast<uint32_t>(bitset.len));
+	column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(bloom_filter_offset));
+	column_chunk.meta_data.__set_bloom_filter_length(
+	    NumericCast<int32_t>(column_writer.GetTotalWritten() - bloom_filter_offset));
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -885,6 +943,24 @@ public:
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
 		return sizeof(TGT);
 	}
+
+	bool HasBloomFilter() override {
+		return write_bloom_filter;
+	}
+
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		// the hashes are computed over the plain-encoded values
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				state.bloom_filter_hashes.push_back(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(&target_value), sizeof(TGT)));
+			}
+		}
+	}
 };
 
 //===--------------------------------------------------------------------===//
@@ -1347,6 +1423,15 @@ public:
 			state.key_bit_width = 0;
 		} else {
 			state.key_bit_width = RleBpDecoder::ComputeBitWidth(state.dictionary.size());
+			if (HasBloomFilter()) {
+				// every distinct value is in the dictionary: we only need to hash those
+				state.bloom_filter_hashes.reserve(state.dictionary.size());
+				for (auto &entry : state.dictionary) {
+					auto &value = entry.first;
+					state.bloom_filter_hashes.push_back(
+					    ParquetBloomFilter::Hash(const_data_ptr_cast(value.GetData()), value.GetSize()));
+				}
+			}
 		}
 	}
 
@@ -1457,6 +1542,27 @@ public:
 			return strings[index].GetSize();
 		}
 	}
+
+	bool HasBloomFilter() override {
+		return write_bloom_filter;
+	}
+
+	void UpdateBloomFilter(BasicColumnWriterState &state_p, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (state.IsDictionaryEncoded()) {
+			// the dictionary has been hashed already
+			return;
+		}
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				state.bloom_filter_hashes.push_back(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+			}
+		}
+	}
 };
 
 //===--------------------------------------------------------------------===//
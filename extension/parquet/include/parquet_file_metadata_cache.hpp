@@ -9,11 +9,14 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/storage/object_cache.hpp"
 #endif
 #include "parquet_types.h"
 
 namespace duckdb {
+class ParquetBloomFilter;
 
 //! ParquetFileMetadataCache
 class ParquetFileMetadataCache : public ObjectCacheEntry {
@@ -32,6 +35,11 @@ public:
 	//! read time
 	time_t read_time;
 
+	//! The Bloom filters of the column chunks that have been read so far, by their offset in the file
+	//! (nullptr if the Bloom filter at that offset cannot be used)
+	unordered_map<int64_t, shared_ptr<ParquetBloomFilter>> bloom_filters;
+	mutex bloom_filter_lock;
+
 public:
 	static string ObjectType() {
 		return "parquet_metadata";
@@ -162,6 +162,9 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Reads the Bloom filter of a column chunk, or fetches it from the metadata cache. Returns nullptr if the column
+	//! chunk has no (usable) Bloom filter.
+	shared_ptr<ParquetBloomFilter> GetBloomFilter(ParquetReaderScanState &state, const ColumnChunk &column_chunk);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -13,6 +13,9 @@ using duckdb_parquet::format::SchemaElement;
 
 struct LogicalType;
 class ColumnReader;
+class ParquetBloomFilter;
+class ResizeableBuffer;
+class TableFilter;
 
 struct ParquetStatisticsUtils {
 
@@ -21,6 +24,47 @@ struct ParquetStatisticsUtils {
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
+
+	//! Whether or not values of the column can be looked up in the Bloom filters of its column chunks
+	static bool BloomFilterSupported(const ColumnReader &reader);
+	//! Whether or not the filter contains equality comparisons that can be checked against a Bloom filter
+	static bool BloomFilterApplicable(const TableFilter &filter);
+	//! Whether or not the Bloom filter of a column chunk (of the given type) proves that no value passes the filter
+	static bool BloomFilterExcludes(const TableFilter &filter, const LogicalType &type,
+	                                const ParquetBloomFilter &bloom_filter);
+};
+
+//! A split-block Bloom filter as defined by the Parquet format: the filter consists of 256-bit blocks of eight 32-bit
+//! words. The upper 32 bits of the (xxHash64) hash of a value select the block, the lower 32 bits set one bit in
+//! every word of that block.
+class ParquetBloomFilter {
+public:
+	explicit ParquetBloomFilter(unique_ptr<ResizeableBuffer> data_p);
+	//! Creates an empty Bloom filter that is sized for the given amount of distinct values and false positive ratio
+	ParquetBloomFilter(Allocator &allocator, idx_t num_entries, double false_positive_ratio);
+	~ParquetBloomFilter();
+
+	//! Whether or not a value with the given hash can be present
+	bool FilterCheck(uint64_t hash) const;
+	//! Adds a value with the given hash to the filter
+	void FilterInsert(uint64_t hash);
+	//! The bitset of the filter, as it is written to a file
+	const ResizeableBuffer &Get() const {
+		return *data;
+	}
+
+	//! Returns the hash of the given value as it is used in Bloom filters
+	static uint64_t Hash(const Value &value);
+	//! Returns the hash of the given plain-encoded value
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+
+	//! The minimum and maximum size of the Bloom filters that are written
+	static constexpr const idx_t MIN_BLOOM_FILTER_BYTES = 32;
+	static constexpr const idx_t MAX_BLOOM_FILTER_BYTES = 1048576;
+
+private:
+	unique_ptr<ResizeableBuffer> data;
+	idx_t block_count;
 };
 
 } // namespace duckdb
@@ -64,7 +64,8 @@ public:
 	ParquetWriter(FileSystem &fs, string file_name, vector<LogicalType> types, vector<string> names,
 	              duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
-	              shared_ptr<ParquetEncryptionConfig> encryption_config);
+	              shared_ptr<ParquetEncryptionConfig> encryption_config, case_insensitive_set_t bloom_filter_columns,
+	              double bloom_filter_fpp);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -87,6 +88,13 @@ public:
 	BufferedFileWriter &GetWriter() {
 		return *writer;
 	}
+	//! Whether or not Bloom filters are written for the (leaf) column with the given path
+	bool HasBloomFilter(const vector<string> &schema_path) const {
+		return !schema_path.empty() && bloom_filter_columns.find(schema_path[0]) != bloom_filter_columns.end();
+	}
+	double BloomFilterFPP() const {
+		return bloom_filter_fpp;
+	}
 	idx_t FileSize() {
 		lock_guard<mutex> glock(lock);
 		return writer->total_written;
@@ -106,6 +114,10 @@ private:
 	duckdb_parquet::format::CompressionCodec::type codec;
 	ChildFieldIDs field_ids;
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
+	//! The (top-level) columns for which Bloom filters are written
+	case_insensitive_set_t bloom_filter_columns;
+	//! The false positive ratio of the Bloom filters
+	double bloom_filter_fpp;
 
 	unique_ptr<BufferedFileWriter> writer;
 	shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
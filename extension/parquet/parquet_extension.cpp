@@ -131,6 +131,10 @@ struct ParquetWriteBindData : public TableFunctionData {
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 
 	ChildFieldIDs field_ids;
+
+	//! The columns for which Bloom filters are written, and their false positive ratio
+	case_insensitive_set_t bloom_filter_columns;
+	double bloom_filter_fpp = 0.01;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -319,6 +323,7 @@ public:
 		table_function.projection_pushdown = true;
 		table_function.filter_pushdown = true;
 		table_function.filter_prune = true;
+		table_function.global_initialization = TableFunctionInitialization::INITIALIZE_ON_EXECUTE;
 		table_function.pushdown_complex_filter = ParquetComplexFilterPushdown;
 		return MultiFileReader::CreateFunctionSet(table_function);
 	}
@@ -923,8 +928,8 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 	auto bind_data = make_uniq<ParquetWriteBindData>();
 	for (auto &option : input.info.options) {
 		const auto loption = StringUtil::Lower(option.first);
-		if (option.second.size() != 1) {
-			// All parquet write options require exactly one argument
+		if (option.second.size() != 1 && loption != "bloom_filter_columns") {
+			// All parquet write options (except for the list of Bloom filter columns) require exactly one argument
 			throw BinderException("%s requires exactly one argument", StringUtil::Upper(loption));
 		}
 		if (loption == "row_group_size" || loption == "chunk_size") {
@@ -992,10 +997,37 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "encryption_config") {
 			bind_data->encryption_config = ParquetEncryptionConfig::Create(context, option.second[0]);
+		} else if (loption == "bloom_filter_columns") {
+			vector<Value> column_values;
+			for (auto &columns_value : option.second) {
+				if (columns_value.type().id() == LogicalTypeId::LIST) {
+					auto &children = ListValue::GetChildren(columns_value);
+					column_values.insert(column_values.end(), children.begin(), children.end());
+				} else {
+					column_values.push_back(columns_value);
+				}
+			}
+			case_insensitive_set_t column_names(names.begin(), names.end());
+			for (auto &column_value : column_values) {
+				auto column_name = column_value.ToString();
+				if (column_names.find(column_name) == column_names.end()) {
+					throw BinderException("Column \"%s\" in BLOOM_FILTER_COLUMNS does not exist", column_name);
+				}
+				bind_data->bloom_filter_columns.insert(column_name);
+			}
+		} else if (loption == "bloom_filter_fpp") {
+			auto fpp = option.second[0].GetValue<double>();
+			if (!(fpp > 0 && fpp < 1)) {
+				throw BinderException("BLOOM_FILTER_FPP must be between 0 and 1 (exclusive)");
+			}
+			bind_data->bloom_filter_fpp = fpp;
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (!bind_data->bloom_filter_columns.empty() && bind_data->encryption_config) {
+		throw NotImplementedException("BLOOM_FILTER_COLUMNS cannot be used in combination with ENCRYPTION_CONFIG");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1019,7 +1051,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	auto &fs = FileSystem::GetFileSystem(context);
 	global_state->writer = make_uniq<ParquetWriter>(fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                                                parquet_bind.codec, parquet_bind.field_ids.Copy(),
-	                                                parquet_bind.kv_metadata, parquet_bind.encryption_config);
+	                                                parquet_bind.kv_metadata, parquet_bind.encryption_config,
+	                                                parquet_bind.bloom_filter_columns, parquet_bind.bloom_filter_fpp);
 	return std::move(global_state);
 }
 
@@ -1138,6 +1171,9 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WriteProperty(106, "field_ids", bind_data.field_ids);
 	serializer.WritePropertyWithDefault<shared_ptr<ParquetEncryptionConfig>>(107, "encryption_config",
 	                                                                         bind_data.encryption_config, nullptr);
+	serializer.WritePropertyWithDefault<case_insensitive_set_t>(108, "bloom_filter_columns",
+	                                                            bind_data.bloom_filter_columns);
+	serializer.WritePropertyWithDefault<double>(109, "bloom_filter_fpp", bind_data.bloom_filter_fpp, 0.01);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1151,6 +1187,9 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->field_ids = deserializer.ReadProperty<ChildFieldIDs>(106, "field_ids");
 	deserializer.ReadPropertyWithDefault<shared_ptr<ParquetEncryptionConfig>>(107, "encryption_config",
 	                                                                          data->encryption_config, nullptr);
+	deserializer.ReadPropertyWithDefault<case_insensitive_set_t>(108, "bloom_filter_columns",
+	                                                             data->bloom_filter_columns);
+	deserializer.ReadPropertyWithDefault<double>(109, "bloom_filter_fpp", data->bloom_filter_fpp, 0.01);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
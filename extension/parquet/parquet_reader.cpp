@@ -22,8 +22,10 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/date.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -650,12 +652,24 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 		// filters contain output chunk index, not file col idx!
 		auto global_id = reader_data.column_mapping[col_idx];
 		auto filter_entry = reader_data.filters->filters.find(global_id);
-		if (stats && filter_entry != reader_data.filters->filters.end()) {
+		if (filter_entry != reader_data.filters->filters.end()) {
 			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
-			auto prune_result = filter.CheckStatistics(*stats);
-			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-				skip_chunk = true;
+			if (stats) {
+				auto prune_result = filter.CheckStatistics(*stats);
+				if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					skip_chunk = true;
+				}
+			}
+			if (!skip_chunk && ParquetStatisticsUtils::BloomFilterSupported(*column_reader) &&
+			    ParquetStatisticsUtils::BloomFilterApplicable(filter)) {
+				// the min/max cannot rule out an equality filter: check the Bloom filter of the column chunk
+				auto &column_chunk = group.columns[column_reader->FileIdx()];
+				auto bloom_filter = GetBloomFilter(state, column_chunk);
+				if (bloom_filter &&
+				    ParquetStatisticsUtils::BloomFilterExcludes(filter, column_reader->Type(), *bloom_filter)) {
+					skip_chunk = true;
+				}
 			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
@@ -669,6 +683,48 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+shared_ptr<ParquetBloomFilter> ParquetReader::GetBloomFilter(ParquetReaderScanState &state,
+                                                             const ColumnChunk &column_chunk) {
+	if (!column_chunk.__isset.meta_data || !column_chunk.meta_data.__isset.bloom_filter_offset ||
+	    parquet_options.encryption_config) {
+		return nullptr;
+	}
+	auto &column_meta_data = column_chunk.meta_data;
+	auto bloom_filter_offset = column_meta_data.bloom_filter_offset;
+	{
+		lock_guard<mutex> guard(metadata->bloom_filter_lock);
+		auto entry = metadata->bloom_filters.find(bloom_filter_offset);
+		if (entry != metadata->bloom_filters.end()) {
+			return entry->second;
+		}
+	}
+	if (bloom_filter_offset <= 0 || idx_t(bloom_filter_offset) >= file_handle->GetFileSize()) {
+		throw InvalidInputException("Bloom filter offset %lld of file \"%s\" is out of bounds",
+		                            bloom_filter_offset, file_name);
+	}
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	if (column_meta_data.__isset.bloom_filter_length && column_meta_data.bloom_filter_length > 0) {
+		transport.Prefetch(bloom_filter_offset, column_meta_data.bloom_filter_length);
+	}
+	transport.SetLocation(bloom_filter_offset);
+
+	shared_ptr<ParquetBloomFilter> result;
+	duckdb_parquet::format::BloomFilterHeader filter_header;
+	filter_header.read(state.thrift_file_proto.get());
+	if (filter_header.algorithm.__isset.BLOCK && filter_header.hash.__isset.XXHASH &&
+	    filter_header.compression.__isset.UNCOMPRESSED && filter_header.numBytes > 0 &&
+	    filter_header.numBytes % 32 == 0 &&
+	    transport.GetLocation() + filter_header.numBytes <= file_handle->GetFileSize()) {
+		auto buffer = make_uniq<ResizeableBuffer>(allocator, filter_header.numBytes);
+		transport.read(buffer->ptr, filter_header.numBytes);
+		result = make_shared<ParquetBloomFilter>(std::move(buffer));
+	}
+
+	lock_guard<mutex> guard(metadata->bloom_filter_lock);
+	metadata->bloom_filters[bloom_filter_offset] = result;
+	return result;
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -740,6 +796,24 @@ void FilterIsNotNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 	}
 }
 
+void FilterBloom(Vector &v, const BloomFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(v, hashes, count);
+
+	UnifiedVectorFormat vdata;
+	UnifiedVectorFormat hdata;
+	v.ToUnifiedFormat(count, vdata);
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		filter_mask[i] = filter_mask[i] && vdata.validity.RowIsValid(vdata.sel->get_index(i)) &&
+		                 filter.LookupHash(hash_data[hdata.sel->get_index(i)]);
+	}
+}
+
 template <class T, class OP>
 void TemplatedFilterOperation(Vector &v, T constant, parquet_filter_t &filter_mask, idx_t count) {
 	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
@@ -880,6 +954,20 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::BLOOM_FILTER:
+		FilterBloom(v, filter.Cast<BloomFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			break;
+		}
+		auto constant_filter = dynamic_filter.filter_data->GetFilter();
+		if (constant_filter) {
+			ApplyFilter(v, *constant_filter, filter_mask, count);
+		}
+		break;
+	}
 	default:
 		D_ASSERT(0);
 		break;
@@ -3,12 +3,16 @@
 #include "duckdb.hpp"
 #include "parquet_decimal_utils.hpp"
 #include "parquet_timestamp.hpp"
+#include "resizable_buffer.hpp"
 #include "string_column_reader.hpp"
 #include "struct_column_reader.hpp"
+#include "zstd/common/xxhash.h"
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/storage/statistics/struct_stats.hpp"
 #endif
 
@@ -352,4 +356,182 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 	return row_group_stats;
 }
 
+bool ParquetStatisticsUtils::BloomFilterSupported(const ColumnReader &reader) {
+	// Bloom filters contain the hashes of the plain-encoded values: we only use them for types whose values can be
+	// encoded without any conversion. Floating point values are excluded, since -0.0 = 0.0 and NaN = NaN are not
+	// bitwise equal.
+	auto physical_type = reader.Schema().type;
+	switch (reader.Type().id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::DATE:
+		return physical_type == Type::INT32;
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UBIGINT:
+		return physical_type == Type::INT64;
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+		return physical_type == Type::BYTE_ARRAY;
+	default:
+		return false;
+	}
+}
+
+bool ParquetStatisticsUtils::BloomFilterApplicable(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		return constant_filter.comparison_type == ExpressionType::COMPARE_EQUAL && !constant_filter.constant.IsNull();
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (BloomFilterApplicable(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!BloomFilterApplicable(*child_filter)) {
+				return false;
+			}
+		}
+		return !conjunction.child_filters.empty();
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetStatisticsUtils::BloomFilterExcludes(const TableFilter &filter, const LogicalType &type,
+                                                 const ParquetBloomFilter &bloom_filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		auto &constant = constant_filter.constant;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL || constant.IsNull() ||
+		    constant.type() != type) {
+			return false;
+		}
+		return !bloom_filter.FilterCheck(ParquetBloomFilter::Hash(constant));
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		// all children have to pass: one excluding child is enough
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (BloomFilterExcludes(*child_filter, type, bloom_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		// e.g., an IN-list: every child has to be excluded
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!BloomFilterExcludes(*child_filter, type, bloom_filter)) {
+				return false;
+			}
+		}
+		return !conjunction.child_filters.empty();
+	}
+	default:
+		return false;
+	}
+}
+
+ParquetBloomFilter::ParquetBloomFilter(unique_ptr<ResizeableBuffer> data_p) : data(std::move(data_p)) {
+	D_ASSERT(data->len % 32 == 0);
+	block_count = data->len / 32;
+}
+
+ParquetBloomFilter::ParquetBloomFilter(Allocator &allocator, idx_t num_entries, double false_positive_ratio) {
+	D_ASSERT(false_positive_ratio > 0 && false_positive_ratio < 1);
+	// the amount of bits for a split-block Bloom filter with the given false positive ratio (see the Parquet spec)
+	auto num_bits = -8.0 * double(num_entries) / std::log(1.0 - std::pow(false_positive_ratio, 1.0 / 8.0));
+	auto num_bytes = MinValue<idx_t>(NextPowerOfTwo(MaxValue<idx_t>(idx_t(num_bits / 8.0), MIN_BLOOM_FILTER_BYTES)),
+	                                  MAX_BLOOM_FILTER_BYTES);
+	data = make_uniq<ResizeableBuffer>(allocator, num_bytes);
+	memset(data->ptr, 0, num_bytes);
+	block_count = num_bytes / 32;
+}
+
+ParquetBloomFilter::~ParquetBloomFilter() {
+}
+
+static const uint32_t PARQUET_BLOOM_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                               0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	if (block_count == 0) {
+		return true;
+	}
+	auto block_idx = ((hash >> 32) * block_count) >> 32;
+	auto key = static_cast<uint32_t>(hash);
+	auto block = data->ptr + block_idx * 32;
+	for (idx_t i = 0; i < 8; i++) {
+		auto word = Load<uint32_t>(block + i * sizeof(uint32_t));
+		uint32_t mask = 1U << ((key * PARQUET_BLOOM_SALT[i]) >> 27);
+		if (!(word & mask)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void ParquetBloomFilter::FilterInsert(uint64_t hash) {
+	D_ASSERT(block_count > 0);
+	auto block_idx = ((hash >> 32) * block_count) >> 32;
+	auto key = static_cast<uint32_t>(hash);
+	auto block = data->ptr + block_idx * 32;
+	for (idx_t i = 0; i < 8; i++) {
+		auto word_ptr = block + i * sizeof(uint32_t);
+		uint32_t mask = 1U << ((key * PARQUET_BLOOM_SALT[i]) >> 27);
+		Store<uint32_t>(Load<uint32_t>(word_ptr) | mask, word_ptr);
+	}
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+template <class T>
+static uint64_t HashFixedWidth(T value) {
+	return ParquetBloomFilter::Hash(const_data_ptr_cast(&value), sizeof(T));
+}
+
+uint64_t ParquetBloomFilter::Hash(const Value &value) {
+	D_ASSERT(!value.IsNull());
+	switch (value.type().id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+		return HashFixedWidth<int32_t>(value.GetValue<int32_t>());
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+		return HashFixedWidth<uint32_t>(value.GetValue<uint32_t>());
+	case LogicalTypeId::DATE:
+		return HashFixedWidth<int32_t>(value.GetValue<date_t>().days);
+	case LogicalTypeId::BIGINT:
+		return HashFixedWidth<int64_t>(value.GetValue<int64_t>());
+	case LogicalTypeId::UBIGINT:
+		return HashFixedWidth<uint64_t>(value.GetValue<uint64_t>());
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB: {
+		auto &str = StringValue::Get(value);
+		return Hash(const_data_ptr_cast(str.c_str()), str.size());
+	}
+	default:
+		throw InternalException("Unsupported type for Parquet Bloom filter");
+	}
+}
+
 } // namespace duckdb
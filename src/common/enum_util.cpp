@@ -125,6 +125,7 @@
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/table/chunk_info.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/temporary_file_manager.hpp"
 #include "duckdb/verification/statement_verifier.hpp"
 
 namespace duckdb {
@@ -4168,6 +4169,12 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "DUPLICATE_GROUPS";
 	case OptimizerType::REORDER_FILTER:
 		return "REORDER_FILTER";
+	case OptimizerType::JOIN_FILTER_PUSHDOWN:
+		return "JOIN_FILTER_PUSHDOWN";
+	case OptimizerType::LATE_MATERIALIZATION:
+		return "LATE_MATERIALIZATION";
+	case OptimizerType::ORDERED_INDEX_SCAN:
+		return "ORDERED_INDEX_SCAN";
 	case OptimizerType::EXTENSION:
 		return "EXTENSION";
 	default:
@@ -4231,6 +4238,15 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "REORDER_FILTER")) {
 		return OptimizerType::REORDER_FILTER;
 	}
+	if (StringUtil::Equals(value, "JOIN_FILTER_PUSHDOWN")) {
+		return OptimizerType::JOIN_FILTER_PUSHDOWN;
+	}
+	if (StringUtil::Equals(value, "LATE_MATERIALIZATION")) {
+		return OptimizerType::LATE_MATERIALIZATION;
+	}
+	if (StringUtil::Equals(value, "ORDERED_INDEX_SCAN")) {
+		return OptimizerType::ORDERED_INDEX_SCAN;
+	}
 	if (StringUtil::Equals(value, "EXTENSION")) {
 		return OptimizerType::EXTENSION;
 	}
@@ -4658,6 +4674,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "EXPRESSION_SCAN";
 	case PhysicalOperatorType::POSITIONAL_SCAN:
 		return "POSITIONAL_SCAN";
+	case PhysicalOperatorType::TABLE_FETCH:
+		return "TABLE_FETCH";
 	case PhysicalOperatorType::BLOCKWISE_NL_JOIN:
 		return "BLOCKWISE_NL_JOIN";
 	case PhysicalOperatorType::NESTED_LOOP_JOIN:
@@ -4846,6 +4864,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "POSITIONAL_SCAN")) {
 		return PhysicalOperatorType::POSITIONAL_SCAN;
 	}
+	if (StringUtil::Equals(value, "TABLE_FETCH")) {
+		return PhysicalOperatorType::TABLE_FETCH;
+	}
 	if (StringUtil::Equals(value, "BLOCKWISE_NL_JOIN")) {
 		return PhysicalOperatorType::BLOCKWISE_NL_JOIN;
 	}
@@ -6540,6 +6561,10 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::BLOOM_FILTER:
+		return "BLOOM_FILTER";
+	case TableFilterType::DYNAMIC_FILTER:
+		return "DYNAMIC_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -6565,6 +6590,35 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "BLOOM_FILTER")) {
+		return TableFilterType::BLOOM_FILTER;
+	}
+	if (StringUtil::Equals(value, "DYNAMIC_FILTER")) {
+		return TableFilterType::DYNAMIC_FILTER;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
+template<>
+const char* EnumUtil::ToChars<TableFunctionInitialization>(TableFunctionInitialization value) {
+	switch(value) {
+	case TableFunctionInitialization::INITIALIZE_ON_SCHEDULE:
+		return "INITIALIZE_ON_SCHEDULE";
+	case TableFunctionInitialization::INITIALIZE_ON_EXECUTE:
+		return "INITIALIZE_ON_EXECUTE";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TableFunctionInitialization EnumUtil::FromString<TableFunctionInitialization>(const char *value) {
+	if (StringUtil::Equals(value, "INITIALIZE_ON_SCHEDULE")) {
+		return TableFunctionInitialization::INITIALIZE_ON_SCHEDULE;
+	}
+	if (StringUtil::Equals(value, "INITIALIZE_ON_EXECUTE")) {
+		return TableFunctionInitialization::INITIALIZE_ON_EXECUTE;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -6720,6 +6774,87 @@ TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value)
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<TemporaryBufferSize>(TemporaryBufferSize value) {
+	switch(value) {
+	case TemporaryBufferSize::INVALID:
+		return "INVALID";
+	case TemporaryBufferSize::S32K:
+		return "S32K";
+	case TemporaryBufferSize::S64K:
+		return "S64K";
+	case TemporaryBufferSize::S96K:
+		return "S96K";
+	case TemporaryBufferSize::S128K:
+		return "S128K";
+	case TemporaryBufferSize::S160K:
+		return "S160K";
+	case TemporaryBufferSize::S192K:
+		return "S192K";
+	case TemporaryBufferSize::S224K:
+		return "S224K";
+	case TemporaryBufferSize::DEFAULT:
+		return "DEFAULT";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TemporaryBufferSize EnumUtil::FromString<TemporaryBufferSize>(const char *value) {
+	if (StringUtil::Equals(value, "INVALID")) {
+		return TemporaryBufferSize::INVALID;
+	}
+	if (StringUtil::Equals(value, "S32K")) {
+		return TemporaryBufferSize::S32K;
+	}
+	if (StringUtil::Equals(value, "S64K")) {
+		return TemporaryBufferSize::S64K;
+	}
+	if (StringUtil::Equals(value, "S96K")) {
+		return TemporaryBufferSize::S96K;
+	}
+	if (StringUtil::Equals(value, "S128K")) {
+		return TemporaryBufferSize::S128K;
+	}
+	if (StringUtil::Equals(value, "S160K")) {
+		return TemporaryBufferSize::S160K;
+	}
+	if (StringUtil::Equals(value, "S192K")) {
+		return TemporaryBufferSize::S192K;
+	}
+	if (StringUtil::Equals(value, "S224K")) {
+		return TemporaryBufferSize::S224K;
+	}
+	if (StringUtil::Equals(value, "DEFAULT")) {
+		return TemporaryBufferSize::DEFAULT;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
+template<>
+const char* EnumUtil::ToChars<TemporaryCompressionType>(TemporaryCompressionType value) {
+	switch(value) {
+	case TemporaryCompressionType::UNCOMPRESSED:
+		return "UNCOMPRESSED";
+	case TemporaryCompressionType::LZ4:
+		return "LZ4";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TemporaryCompressionType EnumUtil::FromString<TemporaryCompressionType>(const char *value) {
+	if (StringUtil::Equals(value, "UNCOMPRESSED")) {
+		return TemporaryCompressionType::UNCOMPRESSED;
+	}
+	if (StringUtil::Equals(value, "LZ4")) {
+		return TemporaryCompressionType::LZ4;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value) {
 	switch(value) {
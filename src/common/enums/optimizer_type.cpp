@@ -28,6 +28,9 @@ static const DefaultOptimizerType internal_optimizer_types[] = {
     {"compressed_materialization", OptimizerType::COMPRESSED_MATERIALIZATION},
     {"duplicate_groups", OptimizerType::DUPLICATE_GROUPS},
     {"reorder_filter", OptimizerType::REORDER_FILTER},
+    {"join_filter_pushdown", OptimizerType::JOIN_FILTER_PUSHDOWN},
+    {"late_materialization", OptimizerType::LATE_MATERIALIZATION},
+    {"ordered_index_scan", OptimizerType::ORDERED_INDEX_SCAN},
     {"extension", OptimizerType::EXTENSION},
     {nullptr, OptimizerType::INVALID}};
 
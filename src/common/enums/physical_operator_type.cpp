@@ -71,6 +71,8 @@ string PhysicalOperatorToString(PhysicalOperatorType type) {
 		return "POSITIONAL_JOIN";
 	case PhysicalOperatorType::POSITIONAL_SCAN:
 		return "POSITIONAL_SCAN";
+	case PhysicalOperatorType::TABLE_FETCH:
+		return "TABLE_FETCH";
 	case PhysicalOperatorType::UNION:
 		return "UNION";
 	case PhysicalOperatorType::INSERT:
@@ -277,6 +277,15 @@ void Vector::Slice(const SelectionVector &sel, idx_t count, SelCache &cache) {
 	}
 }
 
+void Vector::Dictionary(buffer_ptr<VectorChildBuffer> dictionary, const SelectionVector &sel) {
+	D_ASSERT(GetType().InternalType() != PhysicalType::STRUCT);
+	D_ASSERT(dictionary->data.GetType() == GetType());
+	D_ASSERT(dictionary->size.IsValid());
+	vector_type = VectorType::DICTIONARY_VECTOR;
+	buffer = make_buffer<DictionaryBuffer>(sel);
+	auxiliary = std::move(dictionary);
+}
+
 void Vector::Initialize(bool zero_data, idx_t capacity) {
 	auxiliary.reset();
 	validity.Reset();
@@ -1829,6 +1838,35 @@ void ConstantVector::Reference(Vector &vector, Vector &source, idx_t position, i
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// DictionaryVector
+//===--------------------------------------------------------------------===//
+buffer_ptr<VectorChildBuffer> DictionaryVector::CreateSharedDictionary(const LogicalType &type, idx_t size) {
+	auto result = make_buffer<VectorChildBuffer>(Vector(type, size));
+	result->size = size;
+	return result;
+}
+
+bool DictionaryVector::CanCacheHashes(const Vector &vector) {
+	// hashing a dictionary that is larger than a vector might not pay off if only few of its entries are used
+	auto size = DictionarySize(vector);
+	return size.IsValid() && size.GetIndex() <= STANDARD_VECTOR_SIZE;
+}
+
+const Vector &DictionaryVector::GetCachedHashes(const Vector &vector) {
+	D_ASSERT(CanCacheHashes(vector));
+	auto &dictionary = vector.auxiliary->Cast<VectorChildBuffer>();
+	lock_guard<mutex> guard(dictionary.cached_hashes_lock);
+	if (!dictionary.cached_hashes) {
+		auto size = dictionary.size.GetIndex();
+		auto hashes = make_uniq<Vector>(LogicalType::HASH, MaxValue<idx_t>(size, 1));
+		VectorOperations::Hash(dictionary.data, *hashes, size);
+		hashes->Flatten(size);
+		dictionary.cached_hashes = std::move(hashes);
+	}
+	return *dictionary.cached_hashes;
+}
+
 //===--------------------------------------------------------------------===//
 // StringVector
 //===--------------------------------------------------------------------===//
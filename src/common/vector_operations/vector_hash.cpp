@@ -218,9 +218,43 @@ static inline void ArrayLoopHash(Vector &input, Vector &hashes, const SelectionV
 	}
 }
 
+template <bool HAS_RSEL, bool FIRST_HASH>
+static inline void CachedDictionaryHash(Vector &input, Vector &hashes, const SelectionVector *rsel, idx_t count) {
+	// every entry of the dictionary is only hashed once: look up the hashes of the rows
+	auto dictionary_hashes = FlatVector::GetData<hash_t>(DictionaryVector::GetCachedHashes(input));
+	auto &sel = DictionaryVector::SelVector(input);
+	if (FIRST_HASH) {
+		hashes.SetVectorType(VectorType::FLAT_VECTOR);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			hash_data[ridx] = dictionary_hashes[sel.get_index(ridx)];
+		}
+	} else if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		auto constant_hash = *ConstantVector::GetData<hash_t>(hashes);
+		hashes.SetVectorType(VectorType::FLAT_VECTOR);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			hash_data[ridx] = CombineHashScalar(constant_hash, dictionary_hashes[sel.get_index(ridx)]);
+		}
+	} else {
+		D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			hash_data[ridx] = CombineHashScalar(hash_data[ridx], dictionary_hashes[sel.get_index(ridx)]);
+		}
+	}
+}
+
 template <bool HAS_RSEL>
 static inline void HashTypeSwitch(Vector &input, Vector &result, const SelectionVector *rsel, idx_t count) {
 	D_ASSERT(result.GetType().id() == LogicalType::HASH);
+	if (input.GetVectorType() == VectorType::DICTIONARY_VECTOR && DictionaryVector::CanCacheHashes(input)) {
+		CachedDictionaryHash<HAS_RSEL, true>(input, result, rsel, count);
+		return;
+	}
 	switch (input.GetType().InternalType()) {
 	case PhysicalType::BOOL:
 	case PhysicalType::INT8:
@@ -360,6 +394,10 @@ void TemplatedLoopCombineHash(Vector &input, Vector &hashes, const SelectionVect
 template <bool HAS_RSEL>
 static inline void CombineHashTypeSwitch(Vector &hashes, Vector &input, const SelectionVector *rsel, idx_t count) {
 	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
+	if (input.GetVectorType() == VectorType::DICTIONARY_VECTOR && DictionaryVector::CanCacheHashes(input)) {
+		CachedDictionaryHash<HAS_RSEL, false>(input, hashes, rsel, count);
+		return;
+	}
 	switch (input.GetType().InternalType()) {
 	case PhysicalType::BOOL:
 	case PhysicalType::INT8:
@@ -19,18 +19,6 @@
 
 namespace duckdb {
 
-struct ARTIndexScanState : public IndexScanState {
-
-	//! Scan predicates (single predicate scan or range scan)
-	Value values[2];
-	//! Expressions of the scan predicates
-	ExpressionType expressions[2];
-	bool checked = false;
-	//! All scanned row IDs
-	vector<row_t> result_ids;
-	Iterator iterator;
-};
-
 //===--------------------------------------------------------------------===//
 // ART
 //===--------------------------------------------------------------------===//
@@ -97,37 +85,11 @@ ART::ART(const string &name, const IndexConstraintType index_constraint_type, co
 // Initialize Predicate Scans
 //===--------------------------------------------------------------------===//
 
-//! Initialize a single predicate scan on the index with the given expression and column IDs
-static unique_ptr<IndexScanState> InitializeScanSinglePredicate(const Transaction &transaction, const Value &value,
-                                                                const ExpressionType expression_type) {
-	// initialize point lookup
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = value;
-	result->expressions[0] = expression_type;
-	return std::move(result);
-}
-
-//! Initialize a two predicate scan on the index with the given expression and column IDs
-static unique_ptr<IndexScanState> InitializeScanTwoPredicates(const Transaction &transaction, const Value &low_value,
-                                                              const ExpressionType low_expression_type,
-                                                              const Value &high_value,
-                                                              const ExpressionType high_expression_type) {
-	// initialize range lookup
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = low_value;
-	result->expressions[0] = low_expression_type;
-	result->values[1] = high_value;
-	result->expressions[1] = high_expression_type;
-	return std::move(result);
-}
-
-unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction, const Expression &index_expr,
-                                                  const Expression &filter_expr) {
-
-	Value low_value, high_value, equal_value;
-	ExpressionType low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
-	// try to find a matching index for any of the filter expressions
-
+//! Matches a comparison between the index expression and a constant, or a BETWEEN over the index expression, and sets
+//! the respective equality value or bounds
+static void MatchScanPredicate(const Expression &index_expr, const Expression &filter_expr, Value &equal_value,
+                               Value &low_value, ExpressionType &low_comparison_type, Value &high_value,
+                               ExpressionType &high_comparison_type) {
 	// create a matcher for a comparison with a constant
 	ComparisonExpressionMatcher matcher;
 	// match on a comparison type
@@ -154,14 +116,14 @@ unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction
 		}
 		if (comparison_type == ExpressionType::COMPARE_EQUAL) {
 			// equality value
-			// equality overrides any other bounds so we just break here
 			equal_value = constant_value;
 		} else if (comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
 		           comparison_type == ExpressionType::COMPARE_GREATERTHAN) {
 			// greater than means this is a lower bound
 			low_value = constant_value;
 			low_comparison_type = comparison_type;
-		} else {
+		} else if (comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO ||
+		           comparison_type == ExpressionType::COMPARE_LESSTHAN) {
 			// smaller than means this is an upper bound
 			high_value = constant_value;
 			high_comparison_type = comparison_type;
@@ -171,12 +133,12 @@ unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction
 		auto &between = filter_expr.Cast<BoundBetweenExpression>();
 		if (!between.input->Equals(index_expr)) {
 			// expression doesn't match the index expression
-			return nullptr;
+			return;
 		}
 		if (between.lower->type != ExpressionType::VALUE_CONSTANT ||
 		    between.upper->type != ExpressionType::VALUE_CONSTANT) {
 			// not a constant comparison
-			return nullptr;
+			return;
 		}
 		low_value = (between.lower->Cast<BoundConstantExpression>()).value;
 		low_comparison_type = between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
@@ -185,27 +147,45 @@ unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction
 		high_comparison_type =
 		    between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
 	}
+}
 
-	if (!equal_value.IsNull() || !low_value.IsNull() || !high_value.IsNull()) {
-		// we can scan this index using this predicate: try a scan
-		unique_ptr<IndexScanState> index_state;
-		if (!equal_value.IsNull()) {
-			// equality predicate
-			index_state = InitializeScanSinglePredicate(transaction, equal_value, ExpressionType::COMPARE_EQUAL);
-		} else if (!low_value.IsNull() && !high_value.IsNull()) {
-			// two-sided predicate
-			index_state = InitializeScanTwoPredicates(transaction, low_value, low_comparison_type, high_value,
-			                                          high_comparison_type);
-		} else if (!low_value.IsNull()) {
-			// less than predicate
-			index_state = InitializeScanSinglePredicate(transaction, low_value, low_comparison_type);
-		} else {
-			D_ASSERT(!high_value.IsNull());
-			index_state = InitializeScanSinglePredicate(transaction, high_value, high_comparison_type);
+unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction,
+                                                  const vector<unique_ptr<Expression>> &index_exprs,
+                                                  const vector<unique_ptr<Expression>> &filter_exprs) {
+	D_ASSERT(index_exprs.size() == types.size());
+	auto result = make_uniq<ARTIndexScanState>();
+
+	// every filter only narrows down the scanned keys, the filters themselves are still evaluated on the result,
+	// so we use the equality predicates on a prefix of the key columns, and the bounds on the column following it
+	for (idx_t column_idx = 0; column_idx < index_exprs.size(); column_idx++) {
+		Value low_value, high_value, equal_value;
+		ExpressionType low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
+		for (auto &filter_expr : filter_exprs) {
+			MatchScanPredicate(*index_exprs[column_idx], *filter_expr, equal_value, low_value, low_comparison_type,
+			                   high_value, high_comparison_type);
 		}
-		return index_state;
+
+		auto key_type = types[column_idx];
+		if (!equal_value.IsNull() && equal_value.type().InternalType() == key_type) {
+			// equality overrides any other bounds: continue with the next key column
+			result->prefix_values.push_back(equal_value);
+			continue;
+		}
+		if (!low_value.IsNull() && low_value.type().InternalType() == key_type) {
+			result->values[0] = low_value;
+			result->expressions[0] = low_comparison_type;
+		}
+		if (!high_value.IsNull() && high_value.type().InternalType() == key_type) {
+			result->values[1] = high_value;
+			result->expressions[1] = high_comparison_type;
+		}
+		break;
 	}
-	return nullptr;
+
+	if (result->ConstrainedColumnCount() == 0) {
+		return nullptr;
+	}
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -840,143 +820,99 @@ optional_ptr<const Node> ART::Lookup(const Node &node, const ARTKey &key, idx_t
 }
 
 //===--------------------------------------------------------------------===//
-// Greater Than and Less Than
+// Range Scans
 //===--------------------------------------------------------------------===//
 
-bool ART::SearchGreater(ARTIndexScanState &state, ARTKey &key, bool equal, idx_t max_count, vector<row_t> &result_ids) {
-
-	if (!tree.HasMetadata()) {
-		return true;
-	}
-	Iterator &it = state.iterator;
-
-	// find the lowest value that satisfies the predicate
-	if (!it.art) {
-		it.art = this;
-		if (!it.LowerBound(tree, key, equal, 0)) {
-			// early-out, if the maximum value in the ART is lower than the lower bound
-			return true;
+void ART::CreateScanBounds(ArenaAllocator &allocator, ARTIndexScanState &state, ARTKey &lower_bound, bool &lower_equal,
+                           ARTKey &upper_bound, bool &upper_equal) {
+	// all keys start with the values of the equality predicates
+	ARTKey prefix;
+	for (idx_t i = 0; i < state.prefix_values.size(); i++) {
+		auto key = CreateKey(allocator, types[i], state.prefix_values[i]);
+		if (prefix.Empty()) {
+			prefix = key;
+		} else {
+			prefix.ConcatenateARTKey(allocator, key);
 		}
 	}
 
-	// after that we continue the scan; we don't need to check the bounds as any value following this value is
-	// automatically bigger and hence satisfies our predicate
-	ARTKey empty_key = ARTKey();
-	return it.Scan(empty_key, max_count, result_ids, false);
-}
-
-bool ART::SearchLess(ARTIndexScanState &state, ARTKey &upper_bound, bool equal, idx_t max_count,
-                     vector<row_t> &result_ids) {
+	lower_bound = prefix;
+	lower_equal = true;
+	upper_bound = prefix;
+	upper_equal = true;
 
-	if (!tree.HasMetadata()) {
-		return true;
-	}
-	Iterator &it = state.iterator;
-
-	if (!it.art) {
-		it.art = this;
-		// find the minimum value in the ART: we start scanning from this value
-		it.FindMinimum(tree);
-		// early-out, if the minimum value is higher than the upper bound
-		if (it.current_key > upper_bound) {
-			return true;
+	// the next key column is bounded from either or both sides
+	auto column_idx = state.prefix_values.size();
+	if (state.expressions[0] != ExpressionType::INVALID) {
+		auto key = CreateKey(allocator, types[column_idx], state.values[0]);
+		if (lower_bound.Empty()) {
+			lower_bound = key;
+		} else {
+			lower_bound.ConcatenateARTKey(allocator, key);
 		}
+		lower_equal = state.expressions[0] == ExpressionType::COMPARE_GREATERTHANOREQUALTO;
 	}
-
-	// now continue the scan until we reach the upper bound
-	return it.Scan(upper_bound, max_count, result_ids, equal);
-}
-
-//===--------------------------------------------------------------------===//
-// Closed Range Query
-//===--------------------------------------------------------------------===//
-
-bool ART::SearchCloseRange(ARTIndexScanState &state, ARTKey &lower_bound, ARTKey &upper_bound, bool left_equal,
-                           bool right_equal, idx_t max_count, vector<row_t> &result_ids) {
-
-	Iterator &it = state.iterator;
-
-	// find the first node that satisfies the left predicate
-	if (!it.art) {
-		it.art = this;
-		if (!it.LowerBound(tree, lower_bound, left_equal, 0)) {
-			// early-out, if the maximum value in the ART is lower than the lower bound
-			return true;
+	if (state.expressions[1] != ExpressionType::INVALID) {
+		auto key = CreateKey(allocator, types[column_idx], state.values[1]);
+		if (upper_bound.Empty()) {
+			upper_bound = key;
+		} else {
+			upper_bound.ConcatenateARTKey(allocator, key);
 		}
+		upper_equal = state.expressions[1] == ExpressionType::COMPARE_LESSTHANOREQUALTO;
 	}
-
-	// now continue the scan until we reach the upper bound
-	return it.Scan(upper_bound, max_count, result_ids, right_equal);
 }
 
-bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, const idx_t max_count,
-               vector<row_t> &result_ids) {
+bool ART::Scan(IndexScanState &state, const idx_t max_count, vector<row_t> &result_ids) {
 
 	auto &scan_state = state.Cast<ARTIndexScanState>();
-	vector<row_t> row_ids;
-	bool success;
-
-	// FIXME: the key directly owning the data for a single key might be more efficient
-	D_ASSERT(scan_state.values[0].type().InternalType() == types[0]);
-	ArenaAllocator arena_allocator(Allocator::Get(db));
-	auto key = CreateKey(arena_allocator, types[0], scan_state.values[0]);
-
-	if (scan_state.values[1].IsNull()) {
+	if (scan_state.finished) {
+		return false;
+	}
 
-		// single predicate
-		lock_guard<mutex> l(lock);
-		switch (scan_state.expressions[0]) {
-		case ExpressionType::COMPARE_EQUAL:
-			success = SearchEqual(key, max_count, row_ids);
-			break;
-		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
-			success = SearchGreater(scan_state, key, true, max_count, row_ids);
-			break;
-		case ExpressionType::COMPARE_GREATERTHAN:
-			success = SearchGreater(scan_state, key, false, max_count, row_ids);
-			break;
-		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
-			success = SearchLess(scan_state, key, true, max_count, row_ids);
-			break;
-		case ExpressionType::COMPARE_LESSTHAN:
-			success = SearchLess(scan_state, key, false, max_count, row_ids);
-			break;
-		default:
-			throw InternalException("Index scan type not implemented");
-		}
+	lock_guard<mutex> l(lock);
+	if (!tree.HasMetadata()) {
+		scan_state.finished = true;
+		return false;
+	}
 
+	ArenaAllocator arena_allocator(Allocator::Get(db));
+	ARTKey lower_bound, upper_bound;
+	bool lower_equal, upper_equal;
+	CreateScanBounds(arena_allocator, scan_state, lower_bound, lower_equal, upper_bound, upper_equal);
+
+	// the ART can change between two batches, so we position a new iterator at the first key of every batch
+	Iterator it;
+	it.art = this;
+	bool found;
+	if (!scan_state.resume_key.empty()) {
+		ARTKey resume_key(scan_state.resume_key.data(), NumericCast<uint32_t>(scan_state.resume_key.size()));
+		found = it.LowerBound(tree, resume_key, true, 0);
+	} else if (!lower_bound.Empty()) {
+		found = it.LowerBound(tree, lower_bound, lower_equal, 0);
 	} else {
-
-		// two predicates
-		lock_guard<mutex> l(lock);
-
-		D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
-		auto upper_bound = CreateKey(arena_allocator, types[0], scan_state.values[1]);
-
-		bool left_equal = scan_state.expressions[0] == ExpressionType ::COMPARE_GREATERTHANOREQUALTO;
-		bool right_equal = scan_state.expressions[1] == ExpressionType ::COMPARE_LESSTHANOREQUALTO;
-		success = SearchCloseRange(scan_state, key, upper_bound, left_equal, right_equal, max_count, row_ids);
+		it.FindMinimum(tree);
+		found = true;
 	}
-
-	if (!success) {
+	if (!found) {
+		// the lower bound exceeds the maximum value of the ART
+		scan_state.finished = true;
 		return false;
 	}
-	if (row_ids.empty()) {
-		return true;
-	}
-
-	// sort the row ids
-	sort(row_ids.begin(), row_ids.end());
-	// duplicate eliminate the row ids and append them to the row ids of the state
-	result_ids.reserve(row_ids.size());
 
-	result_ids.push_back(row_ids[0]);
-	for (idx_t i = 1; i < row_ids.size(); i++) {
-		if (row_ids[i] != row_ids[i - 1]) {
-			result_ids.push_back(row_ids[i]);
+	auto initial_count = result_ids.size();
+	auto batch_size = max_count;
+	while (!it.Scan(upper_bound, initial_count + batch_size, result_ids, upper_equal)) {
+		if (result_ids.size() > initial_count) {
+			// the batch is full: the next batch starts at the key whose row IDs did not fit anymore
+			scan_state.resume_key = it.current_key.Bytes();
+			return true;
 		}
+		// the row IDs of a single key exceed the batch size
+		batch_size *= 2;
 	}
-	return true;
+	scan_state.finished = true;
+	return result_ids.size() > initial_count;
 }
 
 //===--------------------------------------------------------------------===//
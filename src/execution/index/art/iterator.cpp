@@ -15,7 +15,7 @@ bool IteratorKey::operator>(const ARTKey &key) const {
 			return false;
 		}
 	}
-	return key_bytes.size() > key.len;
+	return false;
 }
 
 bool IteratorKey::operator>=(const ARTKey &key) const {
@@ -106,6 +106,15 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 		return false;
 	}
 
+	if (depth == key.len && node.GetType() != NType::LEAF && node.GetType() != NType::LEAF_INLINED) {
+		// the key is a prefix of all keys in this subtree
+		if (!equal) {
+			return Next();
+		}
+		FindMinimum(node);
+		return true;
+	}
+
 	// we found the lower bound
 	if (node.GetType() == NType::LEAF || node.GetType() == NType::LEAF_INLINED) {
 		if (!equal && current_key == key) {
@@ -145,6 +154,14 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 	nodes.emplace(node, 0);
 
 	for (idx_t i = 0; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+		// the key is a prefix of all keys in this subtree
+		if (depth + i == key.len) {
+			if (!equal) {
+				return Next();
+			}
+			FindMinimum(prefix.ptr);
+			return true;
+		}
 		// the key down to this node is less than the lower bound, the next key will be
 		// greater than the lower bound
 		if (prefix.data[i] < key[depth + i]) {
@@ -5,6 +5,7 @@
 #include "duckdb/common/types/column/column_data_collection_segment.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
@@ -325,6 +326,26 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 	} while (iterator.Next());
 }
 
+void JoinHashTable::InsertIntoBloomFilter(BloomFilter &bloom_filter) {
+	// before Finalize, the hashes of the keys are still stored where the pointers will go
+	D_ASSERT(!finalized);
+	if (Count() == 0) {
+		return;
+	}
+	Vector hashes(LogicalType::HASH);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+
+	TupleDataChunkIterator iterator(*data_collection, TupleDataPinProperties::UNPIN_AFTER_DONE, false);
+	const auto row_locations = iterator.GetRowLocations();
+	do {
+		const auto count = iterator.GetCurrentChunkCount();
+		for (idx_t i = 0; i < count; i++) {
+			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
+		}
+		bloom_filter.InsertHashes(hash_data, count);
+	} while (iterator.Next());
+}
+
 unique_ptr<ScanStructure> JoinHashTable::InitializeScanStructure(DataChunk &keys, TupleDataChunkState &key_state,
                                                                  const SelectionVector *&current_sel) {
 	D_ASSERT(Count() > 0); // should be handled before
@@ -0,0 +1,170 @@
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+
+namespace duckdb {
+
+bool JoinFilterPushdownInfo::SupportsMinMaxFilter(const LogicalType &type) {
+	if (type.id() == LogicalTypeId::TIME_TZ || type.id() == LogicalTypeId::ENUM ||
+	    BaseStatistics::GetStatsType(type) != StatisticsType::NUMERIC_STATS) {
+		return false;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool JoinFilterPushdownInfo::SupportsBloomFilter(const LogicalType &type) {
+	return SupportsMinMaxFilter(type) || type.InternalType() == PhysicalType::VARCHAR;
+}
+
+static vector<unique_ptr<BaseStatistics>> InitializeKeyStats(const vector<idx_t> &join_condition,
+                                                             const vector<LogicalType> &condition_types) {
+	vector<unique_ptr<BaseStatistics>> result;
+	result.resize(condition_types.size());
+	for (auto &cond_idx : join_condition) {
+		auto &type = condition_types[cond_idx];
+		if (JoinFilterPushdownInfo::SupportsMinMaxFilter(type)) {
+			result[cond_idx] = BaseStatistics::CreateEmpty(type).ToUnique();
+		}
+	}
+	return result;
+}
+
+unique_ptr<JoinFilterGlobalState>
+JoinFilterPushdownInfo::GetGlobalState(const vector<LogicalType> &condition_types) const {
+	auto result = make_uniq<JoinFilterGlobalState>();
+	result->key_stats = InitializeKeyStats(join_condition, condition_types);
+	return result;
+}
+
+unique_ptr<JoinFilterLocalState>
+JoinFilterPushdownInfo::GetLocalState(const vector<LogicalType> &condition_types) const {
+	auto result = make_uniq<JoinFilterLocalState>();
+	result->key_stats = InitializeKeyStats(join_condition, condition_types);
+	return result;
+}
+
+template <class T>
+static void TemplatedUpdateMinMax(Vector &keys, idx_t count, BaseStatistics &stats) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	bool has_no_null = false;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		NumericStats::Update<T>(stats, data[idx]);
+		has_no_null = true;
+	}
+	if (has_no_null) {
+		stats.SetHasNoNull();
+	}
+}
+
+static void UpdateMinMax(Vector &keys, idx_t count, BaseStatistics &stats) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedUpdateMinMax<int8_t>(keys, count, stats);
+		break;
+	case PhysicalType::INT16:
+		TemplatedUpdateMinMax<int16_t>(keys, count, stats);
+		break;
+	case PhysicalType::INT32:
+		TemplatedUpdateMinMax<int32_t>(keys, count, stats);
+		break;
+	case PhysicalType::INT64:
+		TemplatedUpdateMinMax<int64_t>(keys, count, stats);
+		break;
+	case PhysicalType::INT128:
+		TemplatedUpdateMinMax<hugeint_t>(keys, count, stats);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedUpdateMinMax<uint8_t>(keys, count, stats);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedUpdateMinMax<uint16_t>(keys, count, stats);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedUpdateMinMax<uint32_t>(keys, count, stats);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedUpdateMinMax<uint64_t>(keys, count, stats);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedUpdateMinMax<uhugeint_t>(keys, count, stats);
+		break;
+	default:
+		throw InternalException("Unsupported type for join filter min/max");
+	}
+}
+
+void JoinFilterPushdownInfo::Sink(DataChunk &join_keys, JoinFilterLocalState &lstate) const {
+	for (auto &cond_idx : join_condition) {
+		auto &stats = lstate.key_stats[cond_idx];
+		if (stats) {
+			UpdateMinMax(join_keys.data[cond_idx], join_keys.size(), *stats);
+		}
+	}
+}
+
+void JoinFilterPushdownInfo::Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const {
+	lock_guard<mutex> guard(gstate.lock);
+	for (auto &cond_idx : join_condition) {
+		auto &stats = lstate.key_stats[cond_idx];
+		if (stats) {
+			gstate.key_stats[cond_idx]->Merge(*stats);
+		}
+	}
+}
+
+void JoinFilterPushdownInfo::PushFilters(const PhysicalOperator &op, JoinFilterGlobalState &gstate,
+                                         optional_ptr<BloomFilter> bloom_filter, idx_t bloom_condition) const {
+	for (auto &target : probe_info) {
+		// remove the filters of a previous execution of this join (e.g., in a recursive CTE)
+		target.dynamic_filters->ClearFilters(op);
+		for (auto &column : target.columns) {
+			auto column_index = column.probe_column.column_index;
+			auto &stats = gstate.key_stats[column.join_condition];
+			if (stats && stats->CanHaveNoNull() && NumericStats::HasMinMax(*stats)) {
+				auto min_val = NumericStats::Min(*stats);
+				auto max_val = NumericStats::Max(*stats);
+				if (min_val == max_val) {
+					// all build-side keys are the same: push an equality filter
+					target.dynamic_filters->PushFilter(
+					    op, column_index, make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val)));
+				} else {
+					target.dynamic_filters->PushFilter(
+					    op, column_index,
+					    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val)));
+					target.dynamic_filters->PushFilter(
+					    op, column_index,
+					    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val)));
+				}
+			}
+			if (bloom_filter && column.join_condition == bloom_condition) {
+				// the Bloom filter is pushed last, so that it only has to be probed for rows within the min/max
+				target.dynamic_filters->PushFilter(op, column_index, bloom_filter->Copy());
+			}
+		}
+	}
+}
+
+} // namespace duckdb
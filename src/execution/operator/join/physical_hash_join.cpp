@@ -13,6 +13,7 @@
 #include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
@@ -103,6 +104,10 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+
+		if (op.filter_pushdown) {
+			global_filter_state = op.filter_pushdown->GetGlobalState(op.condition_types);
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
@@ -136,6 +141,9 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+
+	//! The min/max of the build-side keys for the filters that are pushed into the probe side (if any)
+	unique_ptr<JoinFilterGlobalState> global_filter_state;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -155,6 +163,10 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+
+		if (op.filter_pushdown) {
+			local_filter_state = op.filter_pushdown->GetLocalState(op.condition_types);
+		}
 	}
 
 public:
@@ -168,6 +180,9 @@ public:
 	//! Thread-local HT
 	unique_ptr<JoinHashTable> hash_table;
 
+	//! Thread-local min/max of the build-side keys for the filters that are pushed into the probe side (if any)
+	unique_ptr<JoinFilterLocalState> local_filter_state;
+
 	//! For updating the temporary memory state
 	idx_t chunk_count;
 	static constexpr const idx_t CHUNK_COUNT_UPDATE_INTERVAL = 60;
@@ -238,6 +253,9 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 	// resolve the join keys for the right chunk
 	lstate.join_keys.Reset();
 	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
+	if (filter_pushdown) {
+		filter_pushdown->Sink(lstate.join_keys, *lstate.local_filter_state);
+	}
 
 	// build the HT
 	auto &ht = *lstate.hash_table;
@@ -275,6 +293,9 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 		lock_guard<mutex> local_ht_lock(gstate.lock);
 		gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
 	}
+	if (filter_pushdown) {
+		filter_pushdown->Combine(*gstate.global_filter_state, *lstate.local_filter_state);
+	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(*this, lstate.join_key_executor, "join_key_executor", 1);
 	client_profiler.Flush(context.thread.profiler);
@@ -455,6 +476,31 @@ public:
 	}
 };
 
+void PhysicalHashJoin::PushJoinFilters(HashJoinGlobalSinkState &sink) const {
+	D_ASSERT(filter_pushdown);
+	auto &ht = *sink.hash_table;
+	if (sink.external) {
+		// the keys are spread over the partitions: only push the min/max
+		filter_pushdown->PushFilters(*this, *sink.global_filter_state);
+		return;
+	}
+	// the hash table hashes all equality conditions together,
+	// so a Bloom filter over the hashes can only be used if there is a single equality condition
+	const idx_t bloom_condition = 0;
+	bool use_bloom_filter = ht.equality_types.size() == 1 && conditions[0].comparison == ExpressionType::COMPARE_EQUAL;
+	use_bloom_filter = use_bloom_filter && JoinFilterPushdownInfo::SupportsBloomFilter(condition_types[0]);
+	// the Bloom filter is only worth it if it is small and can eliminate a significant part of the probe side
+	use_bloom_filter = use_bloom_filter && ht.Count() <= BLOOM_FILTER_THRESHOLD;
+	use_bloom_filter = use_bloom_filter && ht.Count() * 2 <= children[0]->estimated_cardinality;
+	if (!use_bloom_filter) {
+		filter_pushdown->PushFilters(*this, *sink.global_filter_state);
+		return;
+	}
+	BloomFilter bloom_filter(ht.Count());
+	ht.InsertIntoBloomFilter(bloom_filter);
+	filter_pushdown->PushFilters(*this, *sink.global_filter_state, &bloom_filter, bloom_condition);
+}
+
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                             OperatorSinkFinalizeInput &input) const {
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
@@ -466,6 +512,9 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	sink.temporary_memory_state->SetRemainingSize(context, total_size);
 
 	sink.external = sink.temporary_memory_state->GetReservation() < total_size;
+	if (filter_pushdown && sink.external) {
+		PushJoinFilters(sink);
+	}
 	if (sink.external) {
 		const auto max_partition_ht_size = max_partition_size + JoinHashTable::PointerTableSize(max_partition_count);
 		// External Hash Join
@@ -495,6 +544,10 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 		}
 		sink.local_hash_tables.clear();
 		ht.Unpartition();
+		if (filter_pushdown && ht.Count() > 0) {
+			// the hashes are overwritten by the pointer chains when the HT is finalized, so push the filters first
+			PushJoinFilters(sink);
+		}
 	}
 
 	// check for possible perfect hash table
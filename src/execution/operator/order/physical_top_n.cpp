@@ -435,6 +435,13 @@ SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, O
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
 	sink.heap.Reduce();
+	if (dynamic_filter && sink.heap.has_boundary_values) {
+		// the values beyond the boundary of the heap can never make it into the Top-N: let the scan skip them
+		auto boundary = sink.heap.boundary_values.GetValue(0, 0);
+		if (!boundary.IsNull()) {
+			dynamic_filter->Tighten(boundary);
+		}
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
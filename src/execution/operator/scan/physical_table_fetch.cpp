@@ -0,0 +1,112 @@
+#include "duckdb/execution/operator/scan/physical_table_fetch.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+PhysicalTableFetch::PhysicalTableFetch(vector<LogicalType> types, DuckTableEntry &table, vector<column_t> column_ids_p,
+                                       idx_t row_id_index, idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::TABLE_FETCH, std::move(types), estimated_cardinality), table(table),
+      column_ids(std::move(column_ids_p)), row_id_index(row_id_index) {
+}
+
+class TableFetchState : public OperatorState {
+public:
+	TableFetchState(ClientContext &context, const PhysicalTableFetch &op)
+	    : persistent_row_ids(LogicalType::ROW_TYPE), local_row_ids(LogicalType::ROW_TYPE), sel(STANDARD_VECTOR_SIZE) {
+		fetch_chunk.Initialize(context, op.types);
+		local_chunk.Initialize(context, op.types);
+	}
+
+	//! The row ids that live in the table and in the transaction-local storage respectively
+	Vector persistent_row_ids;
+	Vector local_row_ids;
+	//! The rows fetched from the table and from the transaction-local storage (if the input has both)
+	DataChunk fetch_chunk;
+	DataChunk local_chunk;
+	//! Maps the fetched rows back to the order of the input
+	SelectionVector sel;
+};
+
+unique_ptr<OperatorState> PhysicalTableFetch::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<TableFetchState>(context.client, *this);
+}
+
+static void FetchRows(DuckTransaction &transaction, DataTable &storage, DataChunk &result,
+                      const vector<column_t> &column_ids, Vector &row_ids, idx_t count, bool local) {
+	ColumnFetchState fetch_state;
+	if (local) {
+		LocalStorage::Get(transaction).FetchChunk(storage, row_ids, count, column_ids, result, fetch_state);
+	} else {
+		storage.Fetch(transaction, result, column_ids, row_ids, count, fetch_state);
+	}
+	if (result.size() != count) {
+		// all rows that were scanned by this transaction must still be visible to it
+		throw InternalException("PhysicalTableFetch - fetched %llu rows but expected %llu", result.size(), count);
+	}
+}
+
+OperatorResultType PhysicalTableFetch::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                               GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<TableFetchState>();
+	auto &transaction = DuckTransaction::Get(context.client, table.catalog);
+	auto &storage = table.GetStorage();
+	auto count = input.size();
+
+	auto &row_ids = input.data[row_id_index];
+	row_ids.Flatten(count);
+	auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+
+	// split the row ids into the ones that live in the table and the ones that live in the transaction-local storage
+	auto persistent_data = FlatVector::GetData<row_t>(state.persistent_row_ids);
+	auto local_data = FlatVector::GetData<row_t>(state.local_row_ids);
+	idx_t persistent_count = 0;
+	idx_t local_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (row_id_data[i] >= MAX_ROW_ID) {
+			local_data[local_count++] = row_id_data[i];
+		} else {
+			persistent_data[persistent_count++] = row_id_data[i];
+		}
+	}
+	if (local_count == 0) {
+		FetchRows(transaction, storage, chunk, column_ids, row_ids, count, false);
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+	if (persistent_count == 0) {
+		FetchRows(transaction, storage, chunk, column_ids, row_ids, count, true);
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+	// the input has both: fetch them separately and restore the order of the input afterwards
+	state.fetch_chunk.Reset();
+	state.local_chunk.Reset();
+	FetchRows(transaction, storage, state.fetch_chunk, column_ids, state.persistent_row_ids, persistent_count, false);
+	FetchRows(transaction, storage, state.local_chunk, column_ids, state.local_row_ids, local_count, true);
+	state.fetch_chunk.Append(state.local_chunk);
+
+	idx_t persistent_idx = 0;
+	idx_t local_idx = persistent_count;
+	for (idx_t i = 0; i < count; i++) {
+		state.sel.set_index(i, row_id_data[i] >= MAX_ROW_ID ? local_idx++ : persistent_idx++);
+	}
+	chunk.Slice(state.fetch_chunk, state.sel, count);
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+string PhysicalTableFetch::ParamsToString() const {
+	string result = table.name + "\n[INFOSEPARATOR]\n";
+	for (auto &column_id : column_ids) {
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			result += "rowid\n";
+		} else {
+			result += table.GetColumn(LogicalIndex(column_id)).Name() + "\n";
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -121,6 +121,27 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	return;
 }
 
+static void RemapFilterPushdownConditions(const vector<JoinCondition> &conditions, JoinFilterPushdownInfo &info) {
+	// the physical join moves all equality conditions to the front (see PhysicalComparisonJoin)
+	// the filters are only pushed for COMPARE_EQUAL conditions, so their index is the number of preceding equalities
+	vector<idx_t> equality_index(conditions.size(), DConstants::INVALID_INDEX);
+	idx_t equal_position = 0;
+	for (idx_t i = 0; i < conditions.size(); i++) {
+		if (conditions[i].comparison == ExpressionType::COMPARE_EQUAL ||
+		    conditions[i].comparison == ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			equality_index[i] = equal_position++;
+		}
+	}
+	for (auto &cond_idx : info.join_condition) {
+		cond_idx = equality_index[cond_idx];
+	}
+	for (auto &target : info.probe_info) {
+		for (auto &column : target.columns) {
+			column.join_condition = equality_index[column.join_condition];
+		}
+	}
+}
+
 static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	if (expr.type == ExpressionType::BOUND_REF) {
 		auto &ref = expr.Cast<BoundReferenceExpression>();
@@ -193,9 +214,14 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
-		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
-		                                   op.join_type, op.left_projection_map, op.right_projection_map,
-		                                   std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		if (op.filter_pushdown) {
+			RemapFilterPushdownConditions(op.conditions, *op.filter_pushdown);
+		}
+		auto hash_join = make_uniq<PhysicalHashJoin>(
+		    op, std::move(left), std::move(right), std::move(op.conditions), op.join_type, op.left_projection_map,
+		    op.right_projection_map, std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		hash_join->filter_pushdown = std::move(op.filter_pushdown);
+		plan = std::move(hash_join);
 
 	} else {
 		static constexpr const idx_t NESTED_LOOP_JOIN_THRESHOLD = 5;
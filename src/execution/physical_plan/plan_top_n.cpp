@@ -1,16 +1,102 @@
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
+#include "duckdb/execution/operator/scan/physical_table_fetch.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanLateMaterializedTopN(LogicalTopN &op) {
+	// map the columns of the Top-N input to the columns emitted by the table scan
+	vector<idx_t> column_map;
+	for (idx_t i = 0; i < op.types.size(); i++) {
+		column_map.push_back(i);
+	}
+	reference<LogicalOperator> child = *op.children[0];
+	while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		auto &proj = child.get().Cast<LogicalProjection>();
+		for (auto &column_index : column_map) {
+			column_index = proj.expressions[column_index]->Cast<BoundReferenceExpression>().index;
+		}
+		child = *proj.children[0];
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	auto &table = get.bind_data->Cast<TableScanBindData>().table;
+	vector<column_t> scan_columns;
+	if (get.projection_ids.empty()) {
+		scan_columns = get.column_ids;
+	} else {
+		for (auto &projection_index : get.projection_ids) {
+			scan_columns.push_back(get.column_ids[projection_index]);
+		}
+	}
+
+	// the scan only emits the columns of the sort keys and the row ids
+	vector<column_t> column_ids;
+	auto add_column = [&](column_t column_id) -> idx_t {
+		for (idx_t i = 0; i < column_ids.size(); i++) {
+			if (column_ids[i] == column_id) {
+				return i;
+			}
+		}
+		column_ids.push_back(column_id);
+		return column_ids.size() - 1;
+	};
+	for (auto &order : op.orders) {
+		ExpressionIterator::EnumerateExpression(order.expression, [&](Expression &expr) {
+			if (expr.type == ExpressionType::BOUND_REF) {
+				auto &ref = expr.Cast<BoundReferenceExpression>();
+				ref.index = add_column(scan_columns[column_map[ref.index]]);
+			}
+		});
+	}
+	auto row_id_index = add_column(COLUMN_IDENTIFIER_ROW_ID);
+	// columns that are only filtered on are scanned but not emitted
+	auto projected_count = column_ids.size();
+	for (auto &filter : get.table_filters.filters) {
+		add_column(filter.first);
+	}
+	get.projection_ids.clear();
+	if (column_ids.size() > projected_count) {
+		for (idx_t i = 0; i < projected_count; i++) {
+			get.projection_ids.push_back(i);
+		}
+	}
+	get.column_ids = std::move(column_ids);
+	get.ResolveOperatorTypes();
+	auto scan = CreatePlan(child.get());
+
+	auto top_n = make_uniq<PhysicalTopN>(scan->types, std::move(op.orders), (idx_t)op.limit, op.offset,
+	                                     op.estimated_cardinality);
+	top_n->dynamic_filter = std::move(op.dynamic_filter);
+	top_n->children.push_back(std::move(scan));
+
+	// fetch the full rows of the Top-N result
+	vector<column_t> fetch_columns;
+	for (auto &column_index : column_map) {
+		fetch_columns.push_back(scan_columns[column_index]);
+	}
+	auto fetch = make_uniq<PhysicalTableFetch>(op.types, table, std::move(fetch_columns), row_id_index,
+	                                           op.estimated_cardinality);
+	fetch->children.push_back(std::move(top_n));
+	return std::move(fetch);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op) {
 	D_ASSERT(op.children.size() == 1);
+	if (op.late_materialization) {
+		return PlanLateMaterializedTopN(op);
+	}
 
 	auto plan = CreatePlan(*op.children[0]);
 
 	auto top_n =
 	    make_uniq<PhysicalTopN>(op.types, std::move(op.orders), (idx_t)op.limit, op.offset, op.estimated_cardinality);
+	top_n->dynamic_filter = std::move(op.dynamic_filter);
 	top_n->children.push_back(std::move(plan));
 	return std::move(top_n);
 }
@@ -22,6 +22,15 @@ static unique_ptr<FunctionData> DuckDBMemoryBind(ClientContext &context, TableFu
 	names.emplace_back("temporary_storage_bytes");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("buffer_hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("buffer_misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
 	return nullptr;
 }
 
@@ -51,6 +60,12 @@ void DuckDBMemoryFunction(ClientContext &context, TableFunctionInput &data_p, Da
 		output.SetValue(col++, count, Value::BIGINT(entry.size));
 		// temporary_storage_bytes, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(entry.evicted_data));
+		// buffer_hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(entry.hits));
+		// buffer_misses, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(entry.misses));
+		// evictions, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(entry.evictions));
 		count++;
 	}
 	output.SetCardinality(count);
@@ -19,6 +19,18 @@ static unique_ptr<FunctionData> DuckDBTemporaryFilesBind(ClientContext &context,
 	names.emplace_back("size");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("block_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("block_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("uncompressed_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("compression_ratio");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
 	return nullptr;
 }
 
@@ -42,10 +54,23 @@ void DuckDBTemporaryFilesFunction(ClientContext &context, TableFunctionInput &da
 		auto &entry = data.entries[data.offset++];
 		// return values:
 		idx_t col = 0;
-		// database_name, VARCHAR
+		// path, VARCHAR
 		output.SetValue(col++, count, entry.path);
-		// database_oid, BIGINT
-		output.SetValue(col++, count, Value::BIGINT(entry.size));
+		// size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
+		// block_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.block_size)));
+		// block_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.block_count)));
+		// uncompressed_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.uncompressed_size)));
+		// compression_ratio, DOUBLE
+		auto stored_size = entry.block_count * entry.block_size;
+		if (stored_size == 0) {
+			output.SetValue(col++, count, Value());
+		} else {
+			output.SetValue(col++, count, Value::DOUBLE(double(entry.uncompressed_size) / double(stored_size)));
+		}
 		count++;
 	}
 	output.SetCardinality(count);
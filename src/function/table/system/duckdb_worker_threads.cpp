@@ -0,0 +1,87 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+namespace duckdb {
+
+struct DuckDBWorkerThreadsData : public GlobalTableFunctionState {
+	DuckDBWorkerThreadsData() : offset(0) {
+	}
+
+	vector<SchedulerThreadInfo> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBWorkerThreadsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                        vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("thread_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("cpu");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("socket");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("tasks_executed");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("tasks_stolen");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("idle_time");
+	return_types.emplace_back(LogicalType::INTERVAL);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBWorkerThreadsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBWorkerThreadsData>();
+
+	result->entries = TaskScheduler::GetScheduler(context).GetThreadInfo();
+	return std::move(result);
+}
+
+static Value OptionalIndexValue(optional_idx index) {
+	if (!index.IsValid()) {
+		return Value(LogicalType::BIGINT);
+	}
+	return Value::BIGINT(NumericCast<int64_t>(index.GetIndex()));
+}
+
+void DuckDBWorkerThreadsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBWorkerThreadsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// thread_id, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.thread_id)));
+		// cpu, BIGINT
+		output.SetValue(col++, count, OptionalIndexValue(entry.cpu));
+		// socket, BIGINT
+		output.SetValue(col++, count, OptionalIndexValue(entry.socket));
+		// tasks_executed, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.tasks_executed)));
+		// tasks_stolen, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.tasks_stolen)));
+		// idle_time, INTERVAL
+		output.SetValue(col++, count,
+		                Value::INTERVAL(Interval::FromMicro(NumericCast<int64_t>(entry.idle_time))));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBWorkerThreadsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_worker_threads", {}, DuckDBWorkerThreadsFunction, DuckDBWorkerThreadsBind,
+	                              DuckDBWorkerThreadsInit));
+}
+
+} // namespace duckdb
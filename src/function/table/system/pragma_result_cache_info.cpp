@@ -0,0 +1,72 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/query_result_cache.hpp"
+
+namespace duckdb {
+
+struct PragmaResultCacheInfoData : public GlobalTableFunctionState {
+	PragmaResultCacheInfoData() : finished(false) {
+	}
+
+	bool finished;
+};
+
+static unique_ptr<FunctionData> PragmaResultCacheInfoBind(ClientContext &context, TableFunctionBindInput &input,
+                                                          vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("entries");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_usage");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("memory_limit");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hit_rate");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> PragmaResultCacheInfoInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<PragmaResultCacheInfoData>();
+}
+
+void PragmaResultCacheInfoFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<PragmaResultCacheInfoData>();
+	if (data.finished) {
+		// signal end of output
+		return;
+	}
+	auto &cache = *ClientData::Get(context).result_cache;
+	auto memory_limit = ClientConfig::GetConfig(context).result_cache_memory_limit;
+	auto lookups = cache.Hits() + cache.Misses();
+
+	idx_t col = 0;
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(cache.EntryCount())));
+	output.SetValue(col++, 0, Value(StringUtil::BytesToHumanReadableString(cache.MemoryUsage())));
+	output.SetValue(col++, 0, Value(StringUtil::BytesToHumanReadableString(memory_limit)));
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(cache.Hits())));
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(cache.Misses())));
+	output.SetValue(col++, 0,
+	                lookups == 0 ? Value(LogicalType::DOUBLE) : Value::DOUBLE(double(cache.Hits()) / double(lookups)));
+	output.SetCardinality(1);
+
+	data.finished = true;
+}
+
+void PragmaResultCacheInfo::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("pragma_result_cache_info", {}, PragmaResultCacheInfoFunction,
+	                              PragmaResultCacheInfoBind, PragmaResultCacheInfoInit));
+}
+
+} // namespace duckdb
@@ -10,6 +10,7 @@
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/optimizer/matcher/expression_matcher.hpp"
+#include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
 #include "duckdb/planner/expression/bound_between_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
@@ -210,25 +211,51 @@ unique_ptr<NodeStatistics> TableScanCardinality(ClientContext &context, const Fu
 // Index Scan
 //===--------------------------------------------------------------------===//
 struct IndexScanGlobalState : public GlobalTableFunctionState {
-	explicit IndexScanGlobalState(data_ptr_t row_id_data) : row_ids(LogicalType::ROW_TYPE, row_id_data) {
-	}
-
-	Vector row_ids;
+	//! The scanned index
+	optional_ptr<ART> index;
+	//! The state of the scan over the index
+	unique_ptr<IndexScanState> index_state;
+	//! The row ids of the current batch
+	vector<row_t> row_ids;
+	//! The amount of row ids of the current batch that have been fetched
+	idx_t row_id_offset = 0;
 	ColumnFetchState fetch_state;
 	TableScanState local_storage_state;
 	vector<storage_t> column_ids;
 	bool finished;
 };
 
+optional_ptr<ART> TableScanFunction::GetScannedIndex(ClientContext &context, const TableScanBindData &bind_data) {
+	auto &storage = bind_data.table.GetStorage();
+	storage.info->InitializeIndexes(context);
+
+	optional_ptr<ART> result;
+	storage.info->indexes.Scan([&](Index &index) {
+		if (index.IsUnknown() || index.index_type != ART::TYPE_NAME || index.name != bind_data.index_name) {
+			return false;
+		}
+		result = &index.Cast<ART>();
+		return true;
+	});
+	return result;
+}
+
 static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
 	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
-	data_ptr_t row_id_data = nullptr;
-	if (!bind_data.result_ids.empty()) {
-		row_id_data = (data_ptr_t)&bind_data.result_ids[0]; // NOLINT - this is not pretty
-	}
-	auto result = make_uniq<IndexScanGlobalState>(row_id_data);
+	auto result = make_uniq<IndexScanGlobalState>();
 	auto &local_storage = LocalStorage::Get(context, bind_data.table.catalog);
 
+	// the predicates of the index scan are derived again for every execution
+	result->index = TableScanFunction::GetScannedIndex(context, bind_data);
+	if (result->index) {
+		auto &transaction = Transaction::Get(context, bind_data.table.catalog);
+		result->index_state =
+		    result->index->TryInitializeScan(transaction, bind_data.index_expressions, bind_data.index_filters);
+	}
+	if (!result->index_state) {
+		throw InternalException("Failed to initialize the scan over index \"%s\"", bind_data.index_name);
+	}
+
 	result->local_storage_state.options.force_fetch_row = ClientConfig::GetConfig(context).force_fetch_row;
 
 	result->column_ids.reserve(input.column_ids.size());
@@ -248,14 +275,54 @@ static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p
 	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
 	auto &local_storage = LocalStorage::Get(transaction);
 
-	if (!state.finished) {
-		bind_data.table.GetStorage().Fetch(transaction, output, state.column_ids, state.row_ids,
-		                                   bind_data.result_ids.size(), state.fetch_state);
-		state.finished = true;
+	while (!state.finished) {
+		if (state.row_id_offset == state.row_ids.size()) {
+			// fetch the row ids of the next batch from the index
+			state.row_ids.clear();
+			state.row_id_offset = 0;
+			if (!state.index->Scan(*state.index_state, STANDARD_VECTOR_SIZE, state.row_ids)) {
+				state.finished = true;
+				break;
+			}
+			if (!bind_data.index_scan_ordered) {
+				// fetching the rows in the order in which they are stored is cheaper
+				std::sort(state.row_ids.begin(), state.row_ids.end());
+			}
+		}
+		auto fetch_count = MinValue<idx_t>(state.row_ids.size() - state.row_id_offset, STANDARD_VECTOR_SIZE);
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(state.row_ids.data() + state.row_id_offset));
+		state.row_id_offset += fetch_count;
+
+		bind_data.table.GetStorage().Fetch(transaction, output, state.column_ids, row_ids, fetch_count,
+		                                   state.fetch_state);
+		if (output.size() > 0) {
+			return;
+		}
 	}
-	if (output.size() == 0) {
-		local_storage.Scan(state.local_storage_state.local_state, state.column_ids, output);
+	local_storage.Scan(state.local_storage_state.local_state, state.column_ids, output);
+}
+
+//! Returns whether none of the key columns after the first constrained_count can be NULL
+static bool KeyColumnsNotNull(DuckTableEntry &table, ART &index, idx_t constrained_count) {
+	for (idx_t i = constrained_count; i < index.unbound_expressions.size(); i++) {
+		auto &expr = *index.unbound_expressions[i];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		auto column_id = index.column_ids[expr.Cast<BoundColumnRefExpression>().binding.column_index];
+		bool not_null = false;
+		for (auto &constraint : table.GetBoundConstraints()) {
+			if (constraint->type == ConstraintType::NOT_NULL &&
+			    constraint->Cast<BoundNotNullConstraint>().index.index == column_id) {
+				not_null = true;
+				break;
+			}
+		}
+		if (!not_null) {
+			return false;
+		}
 	}
+	return true;
 }
 
 static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &expr, bool &rewrite_possible) {
@@ -309,6 +376,12 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 	// Lazily initialize any unknown indexes that might have been loaded by an extension
 	storage.info->InitializeIndexes(context);
 
+	// the index scan is only used if it is selective enough: fetching many rows one-by-one is slower than scanning
+	auto &db_config = DBConfig::GetConfig(context);
+	auto max_count = MaxValue<idx_t>(
+	    db_config.options.index_scan_max_count,
+	    idx_t(db_config.options.index_scan_percentage * double(storage.GetTotalRows())));
+
 	// behold
 	storage.info->indexes.Scan([&](Index &index) {
 		// first rewrite the index expression so the ColumnBindings align with the column bindings of the current table
@@ -325,36 +398,48 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 
 		auto &art_index = index.Cast<ART>();
 
-		if (art_index.unbound_expressions.size() > 1) {
-			// NOTE: index scans are not (yet) supported for compound index keys
-			return false;
+		vector<unique_ptr<Expression>> index_expressions;
+		for (auto &unbound_expression : art_index.unbound_expressions) {
+			auto index_expression = unbound_expression->Copy();
+			bool rewrite_possible = true;
+			RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
+			if (!rewrite_possible) {
+				// could not rewrite!
+				return false;
+			}
+			index_expressions.push_back(std::move(index_expression));
 		}
 
-		auto index_expression = art_index.unbound_expressions[0]->Copy();
-		bool rewrite_possible = true;
-		RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
-		if (!rewrite_possible) {
-			// could not rewrite!
+		// try to find matching predicates for a prefix of the index expressions
+		auto &transaction = Transaction::Get(context, bind_data.table.catalog);
+		auto index_state = art_index.TryInitializeScan(transaction, index_expressions, filters);
+		if (!index_state) {
+			return false;
+		}
+		auto constrained_count = index_state->Cast<ARTIndexScanState>().ConstrainedColumnCount();
+		if (!KeyColumnsNotNull(table, art_index, constrained_count)) {
+			// rows with a NULL in any of the key columns are not in the index
 			return false;
 		}
 
-		// try to find a matching index for any of the filter expressions
-		auto &transaction = Transaction::Get(context, bind_data.table.catalog);
-
-		for (auto &filter : filters) {
-			auto index_state = art_index.TryInitializeScan(transaction, *index_expression, *filter);
-			if (index_state != nullptr) {
-				if (art_index.Scan(transaction, storage, *index_state, STANDARD_VECTOR_SIZE, bind_data.result_ids)) {
-					// use an index scan!
-					bind_data.is_index_scan = true;
-					get.function = TableScanFunction::GetIndexScanFunction();
-				} else {
-					bind_data.result_ids.clear();
-				}
-				return true;
+		// count the matching row ids, until we know that the scan is not selective enough
+		idx_t count = 0;
+		vector<row_t> row_ids;
+		while (count <= max_count && art_index.Scan(*index_state, STANDARD_VECTOR_SIZE, row_ids)) {
+			count += row_ids.size();
+			row_ids.clear();
+		}
+		if (count <= max_count) {
+			// use an index scan!
+			bind_data.is_index_scan = true;
+			bind_data.index_name = art_index.name;
+			bind_data.index_expressions = std::move(index_expressions);
+			for (auto &filter : filters) {
+				bind_data.index_filters.push_back(filter->Copy());
 			}
+			get.function = TableScanFunction::GetIndexScanFunction();
 		}
-		return false;
+		return true;
 	});
 }
 
@@ -372,7 +457,10 @@ static void TableScanSerialize(Serializer &serializer, const optional_ptr<Functi
 	serializer.WriteProperty(102, "table", bind_data.table.name);
 	serializer.WriteProperty(103, "is_index_scan", bind_data.is_index_scan);
 	serializer.WriteProperty(104, "is_create_index", bind_data.is_create_index);
-	serializer.WriteProperty(105, "result_ids", bind_data.result_ids);
+	serializer.WritePropertyWithDefault(105, "index_name", bind_data.index_name);
+	serializer.WritePropertyWithDefault(106, "index_expressions", bind_data.index_expressions);
+	serializer.WritePropertyWithDefault(107, "index_filters", bind_data.index_filters);
+	serializer.WritePropertyWithDefault(108, "index_scan_ordered", bind_data.index_scan_ordered);
 }
 
 static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer, TableFunction &function) {
@@ -387,7 +475,10 @@ static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer,
 	auto result = make_uniq<TableScanBindData>(catalog_entry.Cast<DuckTableEntry>());
 	deserializer.ReadProperty(103, "is_index_scan", result->is_index_scan);
 	deserializer.ReadProperty(104, "is_create_index", result->is_create_index);
-	deserializer.ReadProperty(105, "result_ids", result->result_ids);
+	deserializer.ReadPropertyWithDefault(105, "index_name", result->index_name);
+	deserializer.ReadPropertyWithDefault(106, "index_expressions", result->index_expressions);
+	deserializer.ReadPropertyWithDefault(107, "index_filters", result->index_filters);
+	deserializer.ReadPropertyWithDefault(108, "index_scan_ordered", result->index_scan_ordered);
 	return std::move(result);
 }
 
@@ -425,6 +516,7 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = true;
 	scan_function.filter_prune = true;
+	scan_function.global_initialization = TableFunctionInitialization::INITIALIZE_ON_EXECUTE;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
 	return scan_function;
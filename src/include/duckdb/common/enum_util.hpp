@@ -288,6 +288,8 @@ enum class TableColumnType : uint8_t;
 
 enum class TableFilterType : uint8_t;
 
+enum class TableFunctionInitialization : uint8_t;
+
 enum class TableReferenceType : uint8_t;
 
 enum class TableScanType : uint8_t;
@@ -296,6 +298,10 @@ enum class TaskExecutionMode : uint8_t;
 
 enum class TaskExecutionResult : uint8_t;
 
+enum class TemporaryBufferSize : uint64_t;
+
+enum class TemporaryCompressionType : uint8_t;
+
 enum class TimestampCastResult : uint8_t;
 
 enum class TransactionType : uint8_t;
@@ -709,6 +715,9 @@ const char* EnumUtil::ToChars<TableColumnType>(TableColumnType value);
 template<>
 const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value);
 
+template<>
+const char* EnumUtil::ToChars<TableFunctionInitialization>(TableFunctionInitialization value);
+
 template<>
 const char* EnumUtil::ToChars<TableReferenceType>(TableReferenceType value);
 
@@ -721,6 +730,12 @@ const char* EnumUtil::ToChars<TaskExecutionMode>(TaskExecutionMode value);
 template<>
 const char* EnumUtil::ToChars<TaskExecutionResult>(TaskExecutionResult value);
 
+template<>
+const char* EnumUtil::ToChars<TemporaryBufferSize>(TemporaryBufferSize value);
+
+template<>
+const char* EnumUtil::ToChars<TemporaryCompressionType>(TemporaryCompressionType value);
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value);
 
@@ -1148,6 +1163,9 @@ TableColumnType EnumUtil::FromString<TableColumnType>(const char *value);
 template<>
 TableFilterType EnumUtil::FromString<TableFilterType>(const char *value);
 
+template<>
+TableFunctionInitialization EnumUtil::FromString<TableFunctionInitialization>(const char *value);
+
 template<>
 TableReferenceType EnumUtil::FromString<TableReferenceType>(const char *value);
 
@@ -1160,6 +1178,12 @@ TaskExecutionMode EnumUtil::FromString<TaskExecutionMode>(const char *value);
 template<>
 TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value);
 
+template<>
+TemporaryBufferSize EnumUtil::FromString<TemporaryBufferSize>(const char *value);
+
+template<>
+TemporaryCompressionType EnumUtil::FromString<TemporaryCompressionType>(const char *value);
+
 template<>
 TimestampCastResult EnumUtil::FromString<TimestampCastResult>(const char *value);
 
@@ -49,6 +49,7 @@ enum class PhysicalOperatorType : uint8_t {
 	DELIM_SCAN,
 	EXPRESSION_SCAN,
 	POSITIONAL_SCAN,
+	TABLE_FETCH,
 	// -----------------------------
 	// Joins
 	// -----------------------------
@@ -11,6 +11,8 @@
 #include "duckdb/common/bitset.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/vector_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/types/selection_vector.hpp"
 #include "duckdb/common/types/validity_mask.hpp"
 #include "duckdb/common/types/value.hpp"
@@ -52,6 +54,7 @@ struct RecursiveUnifiedVectorFormat {
 class VectorCache;
 class VectorStructBuffer;
 class VectorListBuffer;
+class VectorChildBuffer;
 
 struct SelCache;
 
@@ -133,6 +136,8 @@ public:
 	DUCKDB_API void Slice(const SelectionVector &sel, idx_t count);
 	//! Slice the vector, keeping the result around in a cache or potentially using the cache instead of slicing
 	DUCKDB_API void Slice(const SelectionVector &sel, idx_t count, SelCache &cache);
+	//! Turns the vector into a dictionary vector over a dictionary that is shared with other vectors
+	DUCKDB_API void Dictionary(buffer_ptr<VectorChildBuffer> dictionary, const SelectionVector &sel);
 
 	//! Creates the data of this vector with the specified type. Any data that
 	//! is currently in the vector is destroyed.
@@ -241,7 +246,7 @@ protected:
 	buffer_ptr<VectorBuffer> auxiliary;
 };
 
-//! The DictionaryBuffer holds a selection vector
+//! The VectorChildBuffer holds the child vector of a dictionary vector
 class VectorChildBuffer : public VectorBuffer {
 public:
 	explicit VectorChildBuffer(Vector vector)
@@ -250,6 +255,11 @@ public:
 
 public:
 	Vector data;
+	//! The amount of entries in the dictionary, only set for dictionaries that are shared across vectors
+	optional_idx size;
+	//! The hashes of the entries of the dictionary, computed when they are first needed
+	unique_ptr<Vector> cached_hashes;
+	mutex cached_hashes_lock;
 };
 
 struct ConstantVector {
@@ -305,6 +315,17 @@ struct DictionaryVector {
 		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
 		return vector.auxiliary->Cast<VectorChildBuffer>().data;
 	}
+	//! The amount of entries in the dictionary, if the dictionary is shared across vectors (e.g. by a storage scan)
+	static inline optional_idx DictionarySize(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.auxiliary->Cast<VectorChildBuffer>().size;
+	}
+	//! Creates a dictionary of the given size that can be shared across vectors using Vector::Dictionary
+	DUCKDB_API static buffer_ptr<VectorChildBuffer> CreateSharedDictionary(const LogicalType &type, idx_t size);
+	//! Whether the hashes of the dictionary entries can be computed once and shared by the vectors using it
+	DUCKDB_API static bool CanCacheHashes(const Vector &vector);
+	//! Returns the hashes of all the entries of the dictionary, computing them on the first call
+	DUCKDB_API static const Vector &GetCachedHashes(const Vector &vector);
 };
 
 struct FlatVector {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/storage/index.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/execution/index/art/node.hpp"
 #include "duckdb/common/array.hpp"
 
@@ -25,12 +26,33 @@ class ARTKey;
 class FixedSizeAllocator;
 
 // structs
-struct ARTIndexScanState;
 struct ARTFlags {
 	vector<bool> vacuum_flags;
 	vector<idx_t> merge_buffer_counts;
 };
 
+//! The state of a (streaming) scan over the ART. The scanned keys start with the values of the equality predicates on
+//! a prefix of the key columns, and are bounded by the predicates on the key column that follows the prefix (if any)
+struct ARTIndexScanState : public IndexScanState {
+	//! Equality predicates on a prefix of the key columns
+	vector<Value> prefix_values;
+	//! Lower (0) and upper (1) bound on the key column that follows the prefix
+	Value values[2];
+	//! Expressions of the bounds, or INVALID if the key column is not bounded from that side
+	ExpressionType expressions[2] = {ExpressionType::INVALID, ExpressionType::INVALID};
+	//! The key at which the next batch of the scan resumes, empty if the scan has not started yet
+	vector<uint8_t> resume_key;
+	//! Whether or not all row IDs have been scanned
+	bool finished = false;
+
+public:
+	//! Returns the amount of leading key columns that are constrained by the predicates of the scan
+	idx_t ConstrainedColumnCount() const {
+		auto has_bound = expressions[0] != ExpressionType::INVALID || expressions[1] != ExpressionType::INVALID;
+		return prefix_values.size() + (has_bound ? 1 : 0);
+	}
+};
+
 class ART : public Index {
 public:
 	// Index type name for the ART
@@ -53,14 +75,15 @@ public:
 	//! True, if the ART owns its data
 	bool owns_data;
 
-	//! Try to initialize a scan on the index with the given expression and filter
-	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction, const Expression &index_expr,
-	                                             const Expression &filter_expr);
+	//! Try to initialize a scan on the index with the given filters over the (bound) index expressions. Returns
+	//! nullptr, if none of the filters constrain the leading key column
+	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction,
+	                                             const vector<unique_ptr<Expression>> &index_exprs,
+	                                             const vector<unique_ptr<Expression>> &filter_exprs);
 
-	//! Performs a lookup on the index, fetching up to max_count result IDs. Returns true if all row IDs were fetched,
-	//! and false otherwise
-	bool Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, idx_t max_count,
-	          vector<row_t> &result_ids);
+	//! Scans the next batch of row IDs that satisfy the predicates of the scan, in key order. A batch holds up to
+	//! max_count row IDs, unless the row IDs of a single key exceed it. Returns false, if there are no more row IDs
+	bool Scan(IndexScanState &state, idx_t max_count, vector<row_t> &result_ids);
 
 public:
 	//! Create a index instance of this type
@@ -128,14 +151,9 @@ private:
 	//! Erase a key from the tree (if a leaf has more than one value) or erase the leaf itself
 	void Erase(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id);
 
-	//! Returns all row IDs belonging to a key greater (or equal) than the search key
-	bool SearchGreater(ARTIndexScanState &state, ARTKey &key, bool equal, idx_t max_count, vector<row_t> &result_ids);
-	//! Returns all row IDs belonging to a key less (or equal) than the upper_bound
-	bool SearchLess(ARTIndexScanState &state, ARTKey &upper_bound, bool equal, idx_t max_count,
-	                vector<row_t> &result_ids);
-	//! Returns all row IDs belonging to a key within the range of lower_bound and upper_bound
-	bool SearchCloseRange(ARTIndexScanState &state, ARTKey &lower_bound, ARTKey &upper_bound, bool left_equal,
-	                      bool right_equal, idx_t max_count, vector<row_t> &result_ids);
+	//! Creates the (prefix) keys that bound the scan
+	void CreateScanBounds(ArenaAllocator &allocator, ARTIndexScanState &state, ARTKey &lower_bound, bool &lower_equal,
+	                      ARTKey &upper_bound, bool &upper_equal);
 
 	//! Initializes a merge operation by returning a set containing the buffer count of each fixed-size allocator
 	void InitializeMerge(ARTFlags &flags);
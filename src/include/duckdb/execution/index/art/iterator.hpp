@@ -40,7 +40,12 @@ public:
 		D_ASSERT(idx < key_bytes.size());
 		return key_bytes[idx];
 	}
-	//! Greater than operator
+	//! Returns the bytes of the current key
+	inline const vector<uint8_t> &Bytes() const {
+		return key_bytes;
+	}
+	//! Greater than operator. A key that starts with a (shorter) key is not greater than it, which allows scans to be
+	//! bounded by a prefix of the key
 	bool operator>(const ARTKey &key) const;
 	//! Greater than or equal to operator
 	bool operator>=(const ARTKey &key) const;
@@ -64,7 +69,8 @@ public:
 	//! Finds the minimum (leaf) of the current subtree
 	void FindMinimum(const Node &node);
 	//! Finds the lower bound of the ART and adds the nodes to the stack. Returns false, if the lower
-	//! bound exceeds the maximum value of the ART
+	//! bound exceeds the maximum value of the ART. The key can be a prefix of the keys in the ART, in which case
+	//! all keys starting with it are equal to it
 	bool LowerBound(const Node &node, const ARTKey &key, const bool equal, idx_t depth);
 
 private:
@@ -22,6 +22,7 @@
 
 namespace duckdb {
 
+class BloomFilter;
 class BufferManager;
 class BufferHandle;
 class ColumnDataCollection;
@@ -131,6 +132,8 @@ public:
 	//! Finalize must be called before any call to Probe, and after Finalize is called Build should no longer be
 	//! ever called.
 	void Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel);
+	//! Inserts the hashes of all keys in the HT into the given Bloom filter, must be called before Finalize
+	void InsertIntoBloomFilter(BloomFilter &bloom_filter);
 	//! Probe the HT with the given input chunk, resulting in the given result
 	unique_ptr<ScanStructure> Probe(DataChunk &keys, TupleDataChunkState &key_state,
 	                                Vector *precomputed_hashes = nullptr);
@@ -0,0 +1,79 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/join_filter_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/planner/column_binding.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+class BloomFilter;
+class DataChunk;
+class PhysicalOperator;
+
+//! A column of a table scan on the probe side of a join, into which filters on a join key can be pushed
+struct JoinFilterPushdownColumn {
+	//! The index of the join condition the filters are derived from
+	idx_t join_condition;
+	//! The probe-side column; once the scan is reached, column_index is the index into the column_ids of the scan
+	ColumnBinding probe_column;
+};
+
+//! A table scan on the probe side of a join, together with the columns into which filters can be pushed
+struct PushdownFilterTarget {
+	PushdownFilterTarget(shared_ptr<DynamicTableFilterSet> dynamic_filters_p,
+	                     vector<JoinFilterPushdownColumn> columns_p)
+	    : dynamic_filters(std::move(dynamic_filters_p)), columns(std::move(columns_p)) {
+	}
+
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	vector<JoinFilterPushdownColumn> columns;
+};
+
+//! Thread-local min/max of the build-side keys
+struct JoinFilterLocalState {
+	//! The statistics of the build-side keys of every join condition (nullptr if no min/max is tracked)
+	vector<unique_ptr<BaseStatistics>> key_stats;
+};
+
+//! Global min/max of the build-side keys
+struct JoinFilterGlobalState {
+	mutex lock;
+	//! The statistics of the build-side keys of every join condition (nullptr if no min/max is tracked)
+	vector<unique_ptr<BaseStatistics>> key_stats;
+};
+
+//! JoinFilterPushdownInfo describes how a join pushes filters derived from its build side into the table scans on its
+//! probe side at runtime: rows of the probe side that cannot find a join partner are then skipped during the scan
+struct JoinFilterPushdownInfo {
+	//! The (equality) join conditions for which filters are pushed
+	vector<idx_t> join_condition;
+	//! The table scans on the probe side into which the filters are pushed
+	vector<PushdownFilterTarget> probe_info;
+
+public:
+	unique_ptr<JoinFilterGlobalState> GetGlobalState(const vector<LogicalType> &condition_types) const;
+	unique_ptr<JoinFilterLocalState> GetLocalState(const vector<LogicalType> &condition_types) const;
+
+	//! Updates the min/max with the build-side keys of the join
+	void Sink(DataChunk &join_keys, JoinFilterLocalState &lstate) const;
+	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
+	//! Pushes the min/max of the build-side keys (and the Bloom filter for the given condition, if any) into the scans
+	void PushFilters(const PhysicalOperator &op, JoinFilterGlobalState &gstate,
+	                 optional_ptr<BloomFilter> bloom_filter = nullptr,
+	                 idx_t bloom_condition = DConstants::INVALID_INDEX) const;
+
+	//! Whether or not min/max filters can be pushed for join keys of the given type
+	static bool SupportsMinMaxFilter(const LogicalType &type);
+	//! Whether or not Bloom filters can be pushed for join keys of the given type
+	static bool SupportsBloomFilter(const LogicalType &type);
+};
+
+} // namespace duckdb
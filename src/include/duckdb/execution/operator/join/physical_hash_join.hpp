@@ -10,6 +10,7 @@
 
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/execution/join_hashtable.hpp"
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
 #include "duckdb/execution/operator/join/perfect_hash_join_executor.hpp"
 #include "duckdb/execution/operator/join/physical_comparison_join.hpp"
 #include "duckdb/execution/physical_operator.hpp"
@@ -17,10 +18,14 @@
 
 namespace duckdb {
 
+class HashJoinGlobalSinkState;
+
 //! PhysicalHashJoin represents a hash loop join between two tables
 class PhysicalHashJoin : public PhysicalComparisonJoin {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::HASH_JOIN;
+	//! The maximum number of build-side keys for which a Bloom filter is pushed into the probe side
+	static constexpr const idx_t BLOOM_FILTER_THRESHOLD = 1048576;
 
 public:
 	PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
@@ -33,6 +38,8 @@ public:
 
 	//! Initialize HT for this operator
 	unique_ptr<JoinHashTable> InitializeHashTable(ClientContext &context) const;
+	//! Pushes the filters derived from the build side into the probe-side table scans
+	void PushJoinFilters(HashJoinGlobalSinkState &sink) const;
 
 	//! The types of the join keys
 	vector<LogicalType> condition_types;
@@ -51,6 +58,8 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! Filters that are pushed into the probe-side table scans after the build side is finished (if any)
+	unique_ptr<JoinFilterPushdownInfo> filter_pushdown;
 
 public:
 	string ParamsToString() const override;
@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/scan/physical_table_fetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+class DuckTableEntry;
+
+//! PhysicalTableFetch fetches a set of columns from a table for the row ids of its input (e.g. the rows that survive a
+//! Top-N that only scanned the sort keys)
+class PhysicalTableFetch : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::TABLE_FETCH;
+
+public:
+	PhysicalTableFetch(vector<LogicalType> types, DuckTableEntry &table, vector<column_t> column_ids,
+	                   idx_t row_id_index, idx_t estimated_cardinality);
+
+	//! The table to fetch from
+	DuckTableEntry &table;
+	//! The columns of the table to fetch, in the order in which they are emitted
+	vector<column_t> column_ids;
+	//! The index of the row id column in the input
+	idx_t row_id_index;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
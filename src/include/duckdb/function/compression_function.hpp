@@ -22,6 +22,7 @@ class ColumnData;
 class ColumnDataCheckpointer;
 class ColumnSegment;
 class SegmentStatistics;
+class TableFilter;
 struct ColumnSegmentState;
 
 struct ColumnFetchState;
@@ -142,6 +143,10 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for scanning a vector and evaluating a filter on the compressed data (optional)
+//! Returns false (without scanning) if the filter cannot be evaluated on the compressed data of this vector
+typedef bool (*compression_filter_t)(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                     SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -226,6 +231,9 @@ public:
 	compression_fetch_row_t fetch_row;
 	//! Skip forward in the compressed segment
 	compression_skip_t skip;
+	//! Scan a vector and evaluate a filter on the compressed data, e.g. once per dictionary entry or per run (optional)
+	//! The filter is evaluated as if all rows are valid: the caller removes the NULLs using the validity mask
+	compression_filter_t filter = nullptr;
 
 	// Append functions
 	//! This only really needs to be defined for uncompressed segments
@@ -41,6 +41,10 @@ struct PragmaDatabaseSize {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct PragmaResultCacheInfo {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBSchemasFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -105,6 +109,10 @@ struct DuckDBTemporaryFilesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBWorkerThreadsFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBTypesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
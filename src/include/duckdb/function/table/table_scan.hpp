@@ -11,8 +11,10 @@
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/function/built_in_functions.hpp"
+#include "duckdb/planner/expression.hpp"
 
 namespace duckdb {
+class ART;
 class DuckTableEntry;
 class TableCatalogEntry;
 
@@ -27,13 +29,22 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_index_scan;
 	//! Whether or not the table scan is for index creation
 	bool is_create_index;
-	//! The row ids to fetch (in case of an index scan)
-	vector<row_t> result_ids;
+	//! The name of the scanned index (in case of an index scan)
+	string index_name;
+	//! The expressions of the index, bound to the columns of the table scan (in case of an index scan)
+	vector<unique_ptr<Expression>> index_expressions;
+	//! The filters from which the predicates of the index scan are derived (in case of an index scan)
+	vector<unique_ptr<Expression>> index_filters;
+	//! Whether or not the index scan has to emit the rows in key order
+	bool index_scan_ordered = false;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<TableScanBindData>();
-		return &other.table == &table && result_ids == other.result_ids;
+		return &other.table == &table && index_name == other.index_name &&
+		       Expression::ListEquals(index_expressions, other.index_expressions) &&
+		       Expression::ListEquals(index_filters, other.index_filters) &&
+		       index_scan_ordered == other.index_scan_ordered;
 	}
 };
 
@@ -42,6 +53,8 @@ struct TableScanFunction {
 	static void RegisterFunction(BuiltinFunctions &set);
 	static TableFunction GetFunction();
 	static TableFunction GetIndexScanFunction();
+	//! Returns the index that is scanned by an index scan (if it still exists)
+	static optional_ptr<ART> GetScannedIndex(ClientContext &context, const TableScanBindData &bind_data);
 };
 
 } // namespace duckdb
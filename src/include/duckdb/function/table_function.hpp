@@ -211,6 +211,15 @@ typedef void (*table_function_serialize_t)(Serializer &serializer, const optiona
                                            const TableFunction &function);
 typedef unique_ptr<FunctionData> (*table_function_deserialize_t)(Deserializer &deserializer, TableFunction &function);
 
+//! When the global state of a table function is initialized
+enum class TableFunctionInitialization : uint8_t {
+	//! The global state is initialized (on the main thread) when the query is scheduled
+	INITIALIZE_ON_SCHEDULE,
+	//! The global state is initialized when the pipeline of the scan is ready for execution, i.e. after all pipelines
+	//! it depends on have finished. This allows filters that are pushed at runtime (e.g. by a hash join) to be used.
+	INITIALIZE_ON_EXECUTE
+};
+
 class TableFunction : public SimpleNamedParameterFunction { // NOLINT: work-around bug in clang-tidy
 public:
 	DUCKDB_API
@@ -280,6 +289,8 @@ public:
 	//! Whether or not the table function can immediately prune out filter columns that are unused in the remainder of
 	//! the query plan, e.g., "SELECT i FROM tbl WHERE j = 42;" - j does not need to leave the table function at all
 	bool filter_prune;
+	//! When the global state of the table function is initialized
+	TableFunctionInitialization global_initialization;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
 
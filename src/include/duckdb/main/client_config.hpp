@@ -102,6 +102,9 @@ struct ClientConfig {
 	//! The threshold at which we switch from using filtered aggregates to LIST with a dedicated pivot operator
 	idx_t pivot_filter_threshold = 10;
 
+	//! The maximum amount of memory used to cache the results of read-only queries (0 disables the result cache)
+	idx_t result_cache_memory_limit = 0;
+
 	//! Whether or not the "/" division operator defaults to integer division or floating point division
 	bool integer_division = false;
 
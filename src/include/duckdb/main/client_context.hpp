@@ -49,6 +49,7 @@ struct ParserOptions;
 class SimpleBufferedData;
 struct ClientData;
 class ClientContextState;
+struct CachedQueryResult;
 
 struct PendingQueryParameters {
 	//! Prepared statement parameters (if any)
@@ -222,6 +223,10 @@ private:
 	unique_ptr<PendingQueryResult> PendingPreparedStatementInternal(ClientContextLock &lock,
 	                                                                shared_ptr<PreparedStatementData> statement_p,
 	                                                                const PendingQueryParameters &parameters);
+	//! Creates a pending query result that scans a result from the query result cache
+	unique_ptr<PendingQueryResult> PendingCachedResultInternal(ClientContextLock &lock,
+	                                                           shared_ptr<CachedQueryResult> cached_result,
+	                                                           const PendingQueryParameters &parameters);
 	void CheckIfPreparedStatementIsExecutable(PreparedStatementData &statement);
 
 	//! Internally prepare a SQL statement. Caller must hold the context_lock.
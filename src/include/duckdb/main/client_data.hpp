@@ -25,6 +25,7 @@ class FileSystem;
 class HTTPState;
 class QueryProfiler;
 class PreparedStatementData;
+class QueryResultCache;
 class SchemaCatalogEntry;
 struct RandomEngine;
 
@@ -39,6 +40,8 @@ struct ClientData {
 	shared_ptr<AttachedDatabase> temporary_objects;
 	//! The set of bound prepared statements that belong to this client
 	case_insensitive_map_t<shared_ptr<PreparedStatementData>> prepared_statements;
+	//! The cached results of read-only queries of this client
+	unique_ptr<QueryResultCache> result_cache;
 
 	//! The writer used to log queries (if logging is enabled)
 	unique_ptr<BufferedFileWriter> log_query_writer;
@@ -56,6 +56,9 @@ enum class CheckpointAbort : uint8_t {
 	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3
 };
 
+//! How blocks that are written to the temporary files are compressed
+enum class TemporaryCompressionType : uint8_t { UNCOMPRESSED = 0, LZ4 = 1 };
+
 typedef void (*set_global_function_t)(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 typedef void (*set_local_function_t)(ClientContext &context, const Value &parameter);
 typedef void (*reset_global_function_t)(DatabaseInstance *db, DBConfig &config);
@@ -98,6 +101,8 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether or not to build a Bloom filter over the values of each column segment that is written to disk
+	bool checkpoint_bloom_filters = false;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -125,10 +130,14 @@ struct DBConfigOptions {
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
 	//! Must be smaller or equal to maximum_threads.
 	idx_t external_threads = 1;
+	//! Whether or not to pin the background threads to CPUs, grouped by socket (Linux only)
+	bool pin_threads = false;
 	//! Whether or not to create and use a temporary directory to store intermediates that do not fit in memory
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! How blocks that are written to the temporary directory are compressed (default: uncompressed)
+	TemporaryCompressionType temporary_compression = TemporaryCompressionType::UNCOMPRESSED;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
@@ -179,6 +188,10 @@ struct DBConfigOptions {
 	bool enable_fsst_vectors = false;
 	//! Start transactions immediately in all attached databases - instead of lazily when a database is referenced
 	bool immediate_transaction_mode = false;
+	//! The maximum amount of rows for which an index scan is used, regardless of the size of the table
+	idx_t index_scan_max_count = STANDARD_VECTOR_SIZE;
+	//! The maximum fraction of the rows of a table for which an index scan is used
+	double index_scan_percentage = 0.001;
 	//! Debug setting - how to initialize  blocks in the storage layer when allocating
 	DebugInitialize debug_initialize = DebugInitialize::NO_INITIALIZE;
 	//! The set of unrecognized (other) options
@@ -21,6 +21,7 @@ class CatalogEntry;
 class ClientContext;
 class PhysicalOperator;
 class SQLStatement;
+struct DataTableInfo;
 
 class PreparedStatementData {
 public:
@@ -48,6 +49,10 @@ public:
 	bound_parameter_map_t value_map;
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
+	//! Whether or not the result of the statement can be stored in the query result cache
+	bool result_cacheable = false;
+	//! The tables the result of the statement depends on (if it can be cached)
+	vector<shared_ptr<DataTableInfo>> result_cache_tables;
 
 public:
 	void CheckParameterCount(idx_t parameter_count);
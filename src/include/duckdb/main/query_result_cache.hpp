@@ -0,0 +1,110 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+
+namespace duckdb {
+class ClientContext;
+class ExecuteStatement;
+class LogicalOperator;
+class SQLStatement;
+struct DataTableInfo;
+
+//! A table that a cached result was computed from, together with the id of the last commit that modified it
+struct CachedResultDependency {
+	shared_ptr<DataTableInfo> table;
+	transaction_t commit_id;
+};
+
+//! A result that is stored in the query result cache
+struct CachedQueryResult {
+	//! The properties of the statement that produced the result
+	StatementProperties properties;
+	//! The names and types of the result columns
+	vector<string> names;
+	vector<LogicalType> types;
+	//! The result set
+	unique_ptr<ColumnDataCollection> collection;
+	//! The catalog version the result was computed with
+	idx_t catalog_version;
+	//! The tables the result depends on
+	vector<CachedResultDependency> dependencies;
+	//! The amount of memory held by the result
+	idx_t memory_usage;
+};
+
+//! The QueryResultCache keeps the results of read-only queries of a client, keyed by their (normalized) query text and
+//! the values of their parameters. Results are invalidated as soon as any of the tables they read from is modified by
+//! a committed transaction, or when the catalog changes.
+class QueryResultCache {
+public:
+	QueryResultCache();
+
+	//! Returns the cache key for a statement, or an empty string if the result of the statement cannot be cached
+	static string GetCacheKey(ClientContext &context, StatementType statement_type, const SQLStatement &statement,
+	                          optional_ptr<case_insensitive_map_t<Value>> parameters);
+	//! Collects the tables a (bound) plan depends on, returns false if the result of the plan cannot be cached
+	static bool GetDependencies(LogicalOperator &plan, vector<shared_ptr<DataTableInfo>> &result);
+
+	//! Looks up a valid result in the cache, returns nullptr if there is none
+	shared_ptr<CachedQueryResult> Lookup(ClientContext &context, const string &key);
+	//! Registers that a query whose result can be cached was not found in the cache
+	void RegisterMiss() {
+		misses++;
+	}
+	//! Stores the result of a prepared statement in the cache
+	void Store(ClientContext &context, const string &key, const PreparedStatementData &statement,
+	           ColumnDataCollection &collection);
+	//! Removes all results from the cache
+	void Clear();
+
+	idx_t EntryCount() const {
+		return entries.size();
+	}
+	idx_t MemoryUsage() const {
+		return memory_usage;
+	}
+	idx_t Hits() const {
+		return hits;
+	}
+	idx_t Misses() const {
+		return misses;
+	}
+
+private:
+	struct CacheEntry {
+		shared_ptr<CachedQueryResult> result;
+		//! The position of the entry in the LRU list
+		list<string>::iterator lru_position;
+	};
+
+	//! Returns the cache key of an EXECUTE of a prepared SELECT statement
+	static string GetExecuteCacheKey(ClientContext &context, const ExecuteStatement &statement);
+	//! Checks whether or not a cached result is still valid for the current transaction
+	static bool IsValid(ClientContext &context, const CachedQueryResult &result);
+	void Evict(unordered_map<string, CacheEntry>::iterator entry);
+
+private:
+	//! The cached results
+	unordered_map<string, CacheEntry> entries;
+	//! The keys of the cached results, from most to least recently used
+	list<string> lru;
+	//! The memory held by all cached results
+	idx_t memory_usage;
+	idx_t hits;
+	idx_t misses;
+};
+
+} // namespace duckdb
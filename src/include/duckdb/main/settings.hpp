@@ -62,6 +62,17 @@ struct AllowPersistentSecrets {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct CheckpointBloomFiltersSetting {
+	static constexpr const char *Name = "checkpoint_bloom_filters";
+	static constexpr const char *Description =
+	    "Whether or not to build a Bloom filter over the values of each column segment that is checkpointed, which is "
+	    "used to skip segments for equality and IN filters";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	static constexpr const char *Name = "checkpoint_threshold";
 	static constexpr const char *Description =
@@ -403,6 +414,28 @@ struct HomeDirectorySetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct IndexScanMaxCountSetting {
+	static constexpr const char *Name = "index_scan_max_count";
+	static constexpr const char *Description =
+	    "The maximum amount of matching rows for which an index scan is used instead of a table scan, if "
+	    "index_scan_percentage of the table is smaller than this";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct IndexScanPercentageSetting {
+	static constexpr const char *Name = "index_scan_percentage";
+	static constexpr const char *Description =
+	    "The maximum fraction of the rows of a table that can match for an index scan to be used instead of a table "
+	    "scan, if index_scan_max_count is smaller than this";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct IntegerDivisionSetting {
 	static constexpr const char *Name = "integer_division";
 	static constexpr const char *Description =
@@ -499,6 +532,16 @@ struct PerfectHashThresholdSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct PinThreadsSetting {
+	static constexpr const char *Name = "pin_threads";
+	static constexpr const char *Description =
+	    "Whether or not to pin the background threads to CPUs, keeping threads that share work on the same socket";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct PivotFilterThreshold {
 	static constexpr const char *Name = "pivot_filter_threshold";
 	static constexpr const char *Description =
@@ -568,6 +611,17 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct ResultCacheMemoryLimitSetting {
+	static constexpr const char *Name = "result_cache_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum memory used to cache the results of repeated read-only queries of this connection (e.g. 1GB), "
+	    "0 disables the cache";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -597,6 +651,16 @@ struct SecretDirectorySetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "The compression used for blocks that are written to the temporary directory (uncompressed or lz4)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct TempDirectorySetting {
 	static constexpr const char *Name = "temp_directory";
 	static constexpr const char *Description = "Set the directory to which to write temp files";
@@ -37,6 +37,9 @@ public:
 
 	ClientContext &context;
 
+	//! The maximum amount of values of an IN list that is pushed into a table scan as an OR of equality filters
+	static constexpr const idx_t MAX_IN_LIST_PUSHDOWN_SIZE = 16;
+
 public:
 	struct ExpressionValueInformation {
 		Value constant;
@@ -0,0 +1,34 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_filter_pushdown_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+
+namespace duckdb {
+
+class LogicalComparisonJoin;
+
+//! The JoinFilterPushdownOptimizer finds the table scans on the probe side of hash joins into which the min/max (and
+//! Bloom filter) of the build-side keys can be pushed at runtime
+class JoinFilterPushdownOptimizer : public LogicalOperatorVisitor {
+public:
+	JoinFilterPushdownOptimizer() {
+	}
+
+	void VisitOperator(LogicalOperator &op) override;
+
+private:
+	void GenerateJoinFilters(LogicalComparisonJoin &join);
+	//! Traces the given columns down to the table scans that produce them
+	static void GetPushdownFilterTargets(LogicalOperator &op, vector<JoinFilterPushdownColumn> columns,
+	                                     vector<PushdownFilterTarget> &targets);
+};
+
+} // namespace duckdb
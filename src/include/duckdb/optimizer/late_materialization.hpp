@@ -0,0 +1,31 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/late_materialization.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/logical_operator_visitor.hpp"
+
+namespace duckdb {
+
+class LogicalTopN;
+
+//! The LateMaterialization optimizer finds Top-N operators over table scans that can be computed on only the sort keys
+//! and the row ids of the table, after which the remaining columns are fetched for the surviving rows only
+class LateMaterialization : public LogicalOperatorVisitor {
+public:
+	//! The maximum amount of rows (LIMIT + OFFSET) for which rows are fetched late
+	static constexpr const idx_t MAX_ROW_COUNT = 1024;
+
+public:
+	void VisitOperator(LogicalOperator &op) override;
+
+private:
+	static bool CanLateMaterialize(LogicalTopN &top_n);
+};
+
+} // namespace duckdb
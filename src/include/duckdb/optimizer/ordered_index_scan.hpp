@@ -0,0 +1,34 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/ordered_index_scan.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+class LogicalOperator;
+class LogicalOrder;
+class Optimizer;
+
+//! The OrderedIndexScan optimizer removes ORDER BY operators over index scans that can emit their rows in the
+//! requested order, by walking the keys of the index in order
+class OrderedIndexScan {
+public:
+	explicit OrderedIndexScan(Optimizer &optimizer);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	//! Tries to make the index scan below the ORDER BY emit its rows in the order of the ORDER BY
+	bool TryOrderIndexScan(LogicalOrder &order);
+
+private:
+	Optimizer &optimizer;
+};
+
+} // namespace duckdb
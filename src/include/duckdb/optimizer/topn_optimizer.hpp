@@ -12,6 +12,7 @@
 
 namespace duckdb {
 class LogicalOperator;
+class LogicalTopN;
 class Optimizer;
 
 class TopN {
@@ -20,6 +21,10 @@ public:
 	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
 	//! Whether we can perform the optimization on this operator
 	static bool CanOptimize(LogicalOperator &op);
+
+private:
+	//! Pushes a filter on the first sort key into the table scan that is tightened while the Top-N runs
+	static void PushdownDynamicFilters(LogicalTopN &op);
 };
 
 } // namespace duckdb
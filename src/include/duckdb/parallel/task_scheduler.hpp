@@ -13,6 +13,8 @@
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 
 namespace duckdb {
 
@@ -23,6 +25,8 @@ class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
+struct WorkerQueue;
+struct WorkerQueueSet;
 
 struct ProducerToken {
 	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
@@ -33,7 +37,25 @@ struct ProducerToken {
 	mutex producer_lock;
 };
 
+//! The task counters of a background worker thread
+struct SchedulerThreadInfo {
+	//! The index of the worker thread
+	idx_t thread_id;
+	//! The CPU and socket the thread is pinned to (if any)
+	optional_idx cpu;
+	optional_idx socket;
+	//! The amount of tasks the thread has executed
+	idx_t tasks_executed;
+	//! The amount of tasks the thread has stolen from the local queues of other threads
+	idx_t tasks_stolen;
+	//! The time (in microseconds) the thread has spent waiting for tasks
+	idx_t idle_time;
+};
+
 //! The TaskScheduler is responsible for managing tasks and threads
+//! Every background thread has a local task queue: tasks that are scheduled from a background thread are pushed to its
+//! local queue, and are executed by the thread itself unless they are stolen by an idle thread. Idle threads prefer to
+//! steal from threads on the same socket, so that the tasks of a pipeline stay close to the memory they work on.
 class TaskScheduler {
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
@@ -77,8 +99,17 @@ public:
 	//! Set the allocator flush threshold
 	void SetAllocatorFlushTreshold(idx_t threshold);
 
+	//! Returns the task counters of the background threads
+	vector<SchedulerThreadInfo> GetThreadInfo();
+
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Fetches a task from the local queue of the worker, the global queue or the local queues of other workers
+	bool GetTask(shared_ptr<Task> &task, optional_ptr<WorkerQueue> worker);
+	//! Returns the local queue of the calling thread, if it is a background thread of this scheduler
+	optional_ptr<WorkerQueue> GetCurrentWorker();
+	//! Pins the background threads to the CPUs of the system (or releases them), grouping them by socket
+	void PinThreads(bool pin);
 
 private:
 	DatabaseInstance &db;
@@ -90,6 +121,10 @@ private:
 	vector<unique_ptr<SchedulerThread>> threads;
 	//! Markers used by the various threads, if the markers are set to "false" the thread execution is stopped
 	vector<unique_ptr<atomic<bool>>> markers;
+	//! The local task queues of the background threads - replaced as a whole when the threads are relaunched
+	shared_ptr<WorkerQueueSet> worker_queues;
+	//! Whether or not the background threads are currently pinned to CPUs
+	bool threads_pinned;
 	//! The threshold after which to flush the allocator after completing a task
 	atomic<idx_t> allocator_flush_threshold;
 	//! Requested thread count (set by the 'threads' setting)
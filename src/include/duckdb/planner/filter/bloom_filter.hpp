@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! The BloomFilter is an approximate set-membership filter over the hashes of the values of a column
+//! Values that were inserted always pass the filter, values that were not inserted pass with a low probability
+//! Every hash sets/probes a fixed number of bits within a single 64-bit block (a "register-blocked" Bloom filter)
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+	//! The (minimum) number of bits that are reserved per expected key
+	static constexpr const idx_t BITS_PER_KEY = 8;
+
+public:
+	//! Creates an empty Bloom filter that is sized for the expected number of keys
+	explicit BloomFilter(idx_t expected_count);
+	//! Creates a Bloom filter from existing blocks, the number of blocks must be a power of two
+	explicit BloomFilter(vector<uint64_t> blocks);
+
+	//! The blocks of the Bloom filter
+	vector<uint64_t> blocks;
+
+public:
+	//! Inserts the given hashes into the Bloom filter
+	void InsertHashes(const hash_t *hashes, idx_t count);
+	//! Whether or not a value with the given hash might have been inserted into the Bloom filter
+	inline bool LookupHash(hash_t hash) const {
+		auto mask = GetMask(hash);
+		return (blocks[hash & block_mask] & mask) == mask;
+	}
+	//! Refines "sel" to the non-NULL values of "vector" that might have been inserted into the Bloom filter
+	idx_t Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count,
+	             idx_t scan_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() const override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	//! The mask to compute the block index from a hash
+	idx_t block_mask;
+
+private:
+	//! The bits that a hash sets within its block (taken from the high bits, the low bits select the block)
+	static inline uint64_t GetMask(hash_t hash) {
+		return (1ULL << ((hash >> 40) & 63)) | (1ULL << ((hash >> 46) & 63)) | (1ULL << ((hash >> 52) & 63)) |
+		       (1ULL << (hash >> 58));
+	}
+};
+
+} // namespace duckdb
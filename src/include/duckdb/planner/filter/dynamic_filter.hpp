@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//! DynamicFilterData holds a constant comparison whose constant is tightened while the query runs
+//! (e.g. the boundary of the heap of a Top-N)
+struct DynamicFilterData {
+	DynamicFilterData(ExpressionType comparison_type, const LogicalType &type);
+
+	mutex lock;
+	//! The comparison, the constant is only set once the filter is initialized
+	ConstantFilter filter;
+	//! Whether or not the constant has been set
+	bool initialized = false;
+
+public:
+	//! Sets the constant of the filter if it is more selective than the current constant
+	void Tighten(const Value &constant);
+	//! Returns a copy of the current filter, or nullptr if the constant has not been set yet
+	unique_ptr<ConstantFilter> GetFilter();
+};
+
+//! The DynamicFilter is a constant comparison whose constant is set at runtime by another operator
+//! Until then (or if it is deserialized) it passes all values
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared state of the filter
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() const override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/planner/bound_query_node.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/logical_operator.hpp"
 
 namespace duckdb {
@@ -28,6 +29,11 @@ public:
 	int64_t limit;
 	//! The offset from the start to begin emitting elements
 	int64_t offset;
+	//! Whether the Top-N is computed on the sort keys and row ids of its table scan, and the remaining columns are
+	//! fetched afterwards
+	bool late_materialization = false;
+	//! The filter on the first sort key that is tightened with the boundary of the heap while the Top-N runs (if any)
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	vector<ColumnBinding> GetColumnBindings() override {
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/array.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
@@ -32,8 +33,22 @@ struct BufferEvictionNode {
 	shared_ptr<BlockHandle> TryGetBlockHandle();
 };
 
+//! Hit, miss and eviction counters of the eviction queue of a memory tag
+struct EvictionQueueStatistics {
+	//! The number of times a block was pinned while it was loaded
+	idx_t hits = 0;
+	//! The number of times a block had to be loaded (from disk or from the temporary directory) to be pinned
+	idx_t misses = 0;
+	//! The number of blocks that were unloaded to free up memory
+	idx_t evictions = 0;
+};
+
 //! The BufferPool is in charge of handling memory management for one or more databases. It defines memory limits
 //! and implements priority eviction among all users of the pool.
+//! Blocks are kept in a separate eviction queue per memory tag. When memory has to be freed, the queues are visited in
+//! a fixed order (see EVICTION_ORDER): persistent blocks, which can be dropped and re-read from the database file
+//! without any I/O, are evicted first, while transient blocks that have to be written to the temporary directory are
+//! only evicted when not enough persistent blocks could be freed.
 class BufferPool {
 	friend class BlockHandle;
 	friend class BlockManager;
@@ -58,6 +73,9 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	//! Returns the hit, miss and eviction counters of the eviction queue of the given tag
+	EvictionQueueStatistics GetEvictionQueueStatistics(MemoryTag tag) const;
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -72,24 +90,22 @@ protected:
 	virtual EvictionResult EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
 	                                   unique_ptr<FileBuffer> *buffer = nullptr);
 
-	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
-	bool TryDequeueWithLock(BufferEvictionNode &node);
-	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
-	void PurgeIteration(const idx_t purge_size);
-	//! Garbage collect dead nodes in the eviction queue.
-	void PurgeQueue();
-	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
+	//! Evict blocks of a single eviction queue until the currently used memory fits the memory limit
+	//! (or until a buffer of size extra_memory could be re-used). Returns false if the queue ran out of blocks first.
+	bool EvictBlocksInternal(EvictionQueue &queue, idx_t extra_memory, idx_t memory_limit,
+	                         unique_ptr<FileBuffer> *buffer);
+
+	//! Returns the eviction queue that holds the blocks of the given tag
+	EvictionQueue &GetEvictionQueueForTag(MemoryTag tag);
+	//! Garbage collect dead nodes in the eviction queue of the given tag.
+	void PurgeQueue(MemoryTag tag);
+	//! Add a buffer handle to the eviction queue of its tag. Returns true, if the queue is
 	//! ready to be purged, and false otherwise.
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
-
-	//! Increment the dead node counter in the purge queue.
-	inline void IncrementDeadNodes() {
-		total_dead_nodes++;
-	}
-	//! Decrement the dead node counter in the purge queue.
-	inline void DecrementDeadNodes() {
-		total_dead_nodes--;
-	}
+	//! Increment the dead node counter in the eviction queue of the given tag.
+	void IncrementDeadNodes(MemoryTag tag);
+	//! Record a pin of a block of the given tag, which either found the block loaded (hit) or had to load it (miss)
+	void RecordPin(MemoryTag tag, bool hit);
 
 protected:
 	//! The lock for changing the memory limit
@@ -98,35 +114,15 @@ protected:
 	atomic<idx_t> current_memory;
 	//! The maximum amount of memory that the buffer manager can keep (in bytes)
 	atomic<idx_t> maximum_memory;
-	//! Eviction queue
-	unique_ptr<EvictionQueue> queue;
+	//! The eviction queues, one per memory tag
+	vector<unique_ptr<EvictionQueue>> queues;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
 	//! Memory usage per tag
 	atomic<idx_t> memory_usage_per_tag[MEMORY_TAG_COUNT];
 
-	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
-	constexpr static idx_t INSERT_INTERVAL = 4096;
-	//! We multiply the base purge size by this value.
-	constexpr static idx_t PURGE_SIZE_MULTIPLIER = 2;
-	//! We multiply the purge size by this value to determine early-outs. This is the minimum queue size.
-	//! We never purge below this point.
-	constexpr static idx_t EARLY_OUT_MULTIPLIER = 4;
-	//! We multiply the approximate alive nodes by this value to test whether our total dead nodes
-	//! exceed their allowed ratio. Must be greater than 1.
-	constexpr static idx_t ALIVE_NODE_MULTIPLIER = 4;
-
-	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
-	atomic<idx_t> evict_queue_insertions;
-	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
-	//! handle, or (2) we insert a newer version into the eviction queue.
-	atomic<idx_t> total_dead_nodes;
-	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
-	//! Only lets a single thread enter the purge phase.
-	mutex purge_lock;
-
-	//! A pre-allocated vector of eviction nodes. We reuse this to keep the allocation overhead of purges small.
-	vector<BufferEvictionNode> purge_nodes;
+	//! The order in which the eviction queues of the tags are visited when evicting blocks
+	static const array<MemoryTag, MEMORY_TAG_COUNT> EVICTION_ORDER;
 };
 
 } // namespace duckdb
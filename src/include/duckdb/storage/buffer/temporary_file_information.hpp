@@ -9,11 +9,24 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	//! The number of pins of blocks with this tag that found the block in memory
+	idx_t hits = 0;
+	//! The number of pins of blocks with this tag that had to load the block
+	idx_t misses = 0;
+	//! The number of blocks with this tag that were evicted from memory
+	idx_t evictions = 0;
 };
 
 struct TemporaryFileInformation {
 	string path;
+	//! The size of the file on disk
 	idx_t size;
+	//! The size of the slots (blocks) in the file
+	idx_t block_size = 0;
+	//! The number of blocks that are stored in the file
+	idx_t block_count = 0;
+	//! The size of the blocks in the file before compression
+	idx_t uncompressed_size = 0;
 };
 
 } // namespace duckdb
@@ -39,6 +39,8 @@ public:
 	//! Reallocate an in-memory buffer that is pinned.
 	virtual void ReAllocate(shared_ptr<BlockHandle> &handle, idx_t block_size) = 0;
 	virtual BufferHandle Pin(shared_ptr<BlockHandle> &handle) = 0;
+	//! Read ahead the given (persistent) blocks, so that pinning them later does not have to wait for I/O
+	virtual void Prefetch(vector<shared_ptr<BlockHandle>> &handles);
 	virtual void Unpin(shared_ptr<BlockHandle> &handle) = 0;
 	//! Returns the currently allocated memory
 	virtual idx_t GetUsedMemory() const = 0;
@@ -76,7 +78,7 @@ public:
 	idx_t GetQueryMaxMemory() const;
 
 protected:
-	virtual void PurgeQueue() = 0;
+	virtual void PurgeQueue(MemoryTag tag) = 0;
 	virtual void AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
 	virtual void WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer);
 	virtual unique_ptr<FileBuffer> ReadTemporaryBuffer(MemoryTag tag, block_id_t id, unique_ptr<FileBuffer> buffer);
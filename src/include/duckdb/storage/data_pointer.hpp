@@ -51,6 +51,8 @@ struct DataPointer {
 	BaseStatistics statistics;
 	//! Serialized segment state
 	unique_ptr<ColumnSegmentState> segment_state;
+	//! The blocks of the Bloom filter over the values of the segment (if any)
+	vector<uint64_t> bloom_filter;
 
 	void Serialize(Serializer &serializer) const;
 	static DataPointer Deserialize(Deserializer &source);
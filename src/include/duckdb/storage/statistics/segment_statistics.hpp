@@ -11,6 +11,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 
 namespace duckdb {
 
@@ -21,6 +22,12 @@ public:
 
 	//! Type-specific statistics of the segment
 	BaseStatistics statistics;
+	//! Bloom filter over the hashes of the values of the segment (if any)
+	unique_ptr<BloomFilter> bloom_filter;
+
+public:
+	//! Checks whether or not an equality (or IN) filter can match any value in the Bloom filter of the segment
+	FilterPropagateResult CheckBloomFilter(TableFilter &filter) const;
 };
 
 } // namespace duckdb
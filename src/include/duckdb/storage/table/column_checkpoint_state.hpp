@@ -25,6 +25,9 @@ class PartialBlockManager;
 class TableDataWriter;
 
 struct ColumnCheckpointState {
+	//! The amount of bits that is reserved per distinct value in the Bloom filters of the segments
+	static constexpr const idx_t BLOOM_FILTER_BITS_PER_KEY = 16;
+
 	ColumnCheckpointState(RowGroup &row_group, ColumnData &column_data, PartialBlockManager &partial_block_manager);
 	virtual ~ColumnCheckpointState();
 
@@ -33,6 +36,10 @@ struct ColumnCheckpointState {
 	ColumnSegmentTree new_tree;
 	vector<DataPointer> data_pointers;
 	unique_ptr<BaseStatistics> global_stats;
+	//! Whether or not Bloom filters are built for the segments that are flushed
+	bool build_bloom_filters = false;
+	//! The hashes of the values of the column in the row group, in row order (if Bloom filters are built)
+	vector<hash_t> value_hashes;
 
 protected:
 	PartialBlockManager &partial_block_manager;
@@ -41,6 +48,8 @@ public:
 	virtual unique_ptr<BaseStatistics> GetStatistics();
 
 	virtual void FlushSegment(unique_ptr<ColumnSegment> segment, idx_t segment_size);
+	//! Creates a Bloom filter over the given hashes of the values of a segment
+	static unique_ptr<BloomFilter> CreateBloomFilter(const hash_t *hashes, idx_t count);
 	virtual void WriteDataPointers(RowGroupWriter &writer, Serializer &serializer);
 
 public:
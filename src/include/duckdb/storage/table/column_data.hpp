@@ -76,6 +76,8 @@ public:
 	//! The root type of the column
 	const LogicalType &RootType() const;
 
+	//! Collect the blocks of the segments that are scanned in the next "rows" rows of an initialized scan
+	virtual void InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows);
 	//! Initialize a scan of the column
 	virtual void InitializeScan(ColumnScanState &state);
 	//! Initialize a scan starting at the specified offset
@@ -90,6 +92,10 @@ public:
 	                    SelectionVector &sel, idx_t &count, const TableFilter &filter);
 	virtual void FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
 	                        SelectionVector &sel, idx_t count);
+	//! Scan a vector and evaluate a filter that rejects NULLs on the compressed data of the current segment.
+	//! The NULLs are not removed from the selection. Returns false (without scanning) if this is not possible.
+	bool FilterCompressed(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
+	                      idx_t &approved_tuple_count, const TableFilter &filter);
 	virtual void FilterScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
 	                                 idx_t count, bool allow_updates);
 
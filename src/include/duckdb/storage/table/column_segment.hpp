@@ -29,6 +29,7 @@ class UpdateSegment;
 class TableFilter;
 struct ColumnFetchState;
 struct ColumnScanState;
+struct PrefetchState;
 struct ColumnAppendState;
 
 enum class ColumnSegmentType : uint8_t { TRANSIENT, PERSISTENT };
@@ -62,9 +63,14 @@ public:
 	                                                        idx_t segment_size = Storage::BLOCK_SIZE);
 
 public:
+	void InitializePrefetch(PrefetchState &prefetch_state);
 	void InitializeScan(ColumnScanState &state);
 	//! Scan one vector from this segment
 	void Scan(ColumnScanState &state, idx_t scan_count, Vector &result, idx_t result_offset, bool entire_vector);
+	//! Scan one vector from this segment and evaluate the filter on the compressed data, if the compression function
+	//! supports it. Returns false (without scanning) otherwise.
+	bool Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+	            idx_t &approved_tuple_count, const TableFilter &filter);
 	//! Fetch a value of the specific row id and append it to the result
 	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx);
 
@@ -37,6 +37,8 @@ struct DataTableInfo {
 	TableIndexList indexes;
 	//! Index storage information of the indexes created by this table
 	vector<IndexStorageInfo> index_storage_infos;
+	//! The commit id of the last transaction that modified the data of the table
+	atomic<transaction_t> last_commit_id;
 
 	bool IsTemporary() const;
 };
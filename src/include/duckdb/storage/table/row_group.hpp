@@ -87,6 +87,8 @@ public:
 
 	//! Initialize a scan over this row_group
 	bool InitializeScan(CollectionScanState &state);
+	//! Read ahead the blocks of the columns that are scanned from the current position of the scan
+	void PrefetchScan(CollectionScanState &state);
 	bool InitializeScanWithOffset(CollectionScanState &state, idx_t vector_offset);
 	//! Checks the given set of table filters against the row-group statistics. Returns false if the entire row group
 	//! can be skipped.
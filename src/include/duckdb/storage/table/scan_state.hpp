@@ -100,6 +100,13 @@ public:
 	void NextInternal(idx_t count);
 };
 
+//! The blocks that are read ahead when the scan of a row group is initialized
+struct PrefetchState {
+	vector<shared_ptr<BlockHandle>> blocks;
+
+	void AddBlock(shared_ptr<BlockHandle> block);
+};
+
 struct ColumnFetchState {
 	//! The set of pinned block handles for this set of fetches
 	buffer_handle_set_t handles;
@@ -19,6 +19,24 @@
 
 namespace duckdb {
 
+//===--------------------------------------------------------------------===//
+// TemporaryBufferSize
+//===--------------------------------------------------------------------===//
+
+//! The size of the slots of a temporary file. Uncompressed blocks are written to files with DEFAULT slots, compressed
+//! blocks are written to the files with the smallest slots they fit in.
+enum class TemporaryBufferSize : uint64_t {
+	INVALID = 0,
+	S32K = 32768,
+	S64K = 65536,
+	S96K = 98304,
+	S128K = 131072,
+	S160K = 163840,
+	S192K = 196608,
+	S224K = 229376,
+	DEFAULT = DEFAULT_BLOCK_ALLOC_SIZE
+};
+
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
@@ -35,6 +53,8 @@ public:
 	bool RemoveIndex(idx_t index);
 	idx_t GetMaxIndex();
 	bool HasFreeBlocks();
+	//! The number of block indexes that are in use
+	idx_t GetBlockCount();
 
 private:
 	idx_t GetNewBlockIndexInternal();
@@ -69,7 +89,8 @@ class TemporaryFileHandle {
 	constexpr static idx_t MAX_ALLOWED_INDEX_BASE = 4000;
 
 public:
-	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index);
+	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
+	                    TemporaryBufferSize size);
 
 public:
 	struct TemporaryFileLock {
@@ -82,7 +103,8 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes the buffer to the given index, or the compressed buffer if it is set
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
@@ -96,11 +118,18 @@ private:
 private:
 	const idx_t max_allowed_index;
 	DatabaseInstance &db;
+	//! The size of the slots in this file
+	const TemporaryBufferSize size;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
+
+public:
+	TemporaryBufferSize GetSize() const {
+		return size;
+	}
 };
 
 class TemporaryFileManager;
@@ -147,6 +176,9 @@ public:
 	vector<TemporaryFileInformation> GetTemporaryFiles();
 
 private:
+	//! Compresses the buffer into compressed_buffer if compression is enabled and worthwhile
+	//! Returns the slot size of the file that the block must be written to
+	TemporaryBufferSize CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
@@ -11,6 +11,7 @@
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/execution/column_binding_resolver.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/main/appender.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -22,6 +23,7 @@
 #include "duckdb/main/materialized_query_result.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/query_result.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/relation.hpp"
 #include "duckdb/main/stream_query_result.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
@@ -37,6 +39,7 @@
 #include "duckdb/parser/statement/relation_statement.hpp"
 #include "duckdb/parser/statement/select_statement.hpp"
 #include "duckdb/planner/operator/logical_execute.hpp"
+#include "duckdb/planner/operator/logical_prepare.hpp"
 #include "duckdb/planner/planner.hpp"
 #include "duckdb/planner/pragma_handler.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
@@ -57,6 +60,10 @@ public:
 	unique_ptr<Executor> executor;
 	//! The progress bar
 	unique_ptr<ProgressBar> progress_bar;
+	//! The key under which the result of the query is stored in the result cache (if it can be cached)
+	string result_cache_key;
+	//! The cached result that is scanned by the query (if any)
+	shared_ptr<CachedQueryResult> cached_result;
 
 public:
 	void SetOpenResult(BaseQueryResult &result) {
@@ -288,6 +295,11 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	D_ASSERT(executor.HasResultCollector());
 	// we have a result collector - fetch the result directly from the result collector
 	result = executor.GetResult();
+	if (!create_stream_result && !active_query->result_cache_key.empty() && !result->HasError() &&
+	    result->type == QueryResultType::MATERIALIZED_RESULT) {
+		auto &materialized = result->Cast<MaterializedQueryResult>();
+		client_data->result_cache->Store(*this, active_query->result_cache_key, prepared, materialized.Collection());
+	}
 	if (!create_stream_result) {
 		CleanupInternal(lock, result.get(), false);
 	} else {
@@ -339,6 +351,10 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 	if (!planner.properties.bound_all_parameters) {
 		return result;
 	}
+	if (ClientConfig::GetConfig(*this).result_cache_memory_limit > 0 &&
+	    (statement_type == StatementType::SELECT_STATEMENT || statement_type == StatementType::EXECUTE_STATEMENT)) {
+		result->result_cacheable = QueryResultCache::GetDependencies(*plan, result->result_cache_tables);
+	}
 #ifdef DEBUG
 	plan->Verify(*this);
 #endif
@@ -348,6 +364,13 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 		plan = optimizer.Optimize(std::move(plan));
 		D_ASSERT(plan);
 		profiler.EndPhase();
+		// the optimizer can make the plan depend on the state of the transaction
+		auto always_require_rebind = planner.binder->properties.always_require_rebind;
+		result->properties.always_require_rebind |= always_require_rebind;
+		if (plan->type == LogicalOperatorType::LOGICAL_PREPARE) {
+			// the plan of a PREPARE statement is optimized as part of the PREPARE statement
+			plan->Cast<LogicalPrepare>().prepared->properties.always_require_rebind |= always_require_rebind;
+		}
 
 #ifdef DEBUG
 		plan->Verify(*this);
@@ -509,9 +532,43 @@ ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_
 	return pending_result;
 }
 
+unique_ptr<PendingQueryResult> ClientContext::PendingCachedResultInternal(ClientContextLock &lock,
+                                                                          shared_ptr<CachedQueryResult> cached_result,
+                                                                          const PendingQueryParameters &parameters) {
+	// scan the cached result instead of planning and executing the query
+	auto prepared = make_shared<PreparedStatementData>(StatementType::SELECT_STATEMENT);
+	prepared->properties = cached_result->properties;
+	prepared->properties.parameter_count = 0;
+	prepared->names = cached_result->names;
+	prepared->types = cached_result->types;
+	prepared->catalog_version = cached_result->catalog_version;
+	auto scan = make_uniq<PhysicalColumnDataScan>(cached_result->types, PhysicalOperatorType::COLUMN_DATA_SCAN,
+	                                              cached_result->collection->Count());
+	scan->collection = cached_result->collection.get();
+	prepared->plan = std::move(scan);
+
+	PendingQueryParameters scan_parameters;
+	scan_parameters.allow_stream_result = parameters.allow_stream_result;
+	auto pending = PendingPreparedStatementInternal(lock, std::move(prepared), scan_parameters);
+	// keep the cached result alive while it is being scanned
+	active_query->cached_result = std::move(cached_result);
+	return pending;
+}
+
 unique_ptr<PendingQueryResult> ClientContext::PendingPreparedStatement(ClientContextLock &lock, const string &query,
                                                                        shared_ptr<PreparedStatementData> prepared,
                                                                        const PendingQueryParameters &parameters) {
+	string cache_key;
+	if (prepared->unbound_statement) {
+		cache_key = QueryResultCache::GetCacheKey(*this, prepared->statement_type, *prepared->unbound_statement,
+		                                          parameters.parameters);
+	}
+	if (!cache_key.empty()) {
+		auto cached_result = client_data->result_cache->Lookup(*this, cache_key);
+		if (cached_result) {
+			return PendingCachedResultInternal(lock, std::move(cached_result), parameters);
+		}
+	}
 	CheckIfPreparedStatementIsExecutable(*prepared);
 
 	RebindQueryInfo rebind = RebindQueryInfo::DO_NOT_REBIND;
@@ -527,7 +584,13 @@ unique_ptr<PendingQueryResult> ClientContext::PendingPreparedStatement(ClientCon
 	if (rebind == RebindQueryInfo::ATTEMPT_TO_REBIND) {
 		RebindPreparedStatement(lock, query, prepared, parameters);
 	}
-	return PendingPreparedStatementInternal(lock, prepared, parameters);
+	auto result_cacheable = prepared->result_cacheable;
+	auto pending = PendingPreparedStatementInternal(lock, prepared, parameters);
+	if (!cache_key.empty() && result_cacheable) {
+		client_data->result_cache->RegisterMiss();
+		active_query->result_cache_key = std::move(cache_key);
+	}
+	return pending;
 }
 
 PendingExecutionResult ClientContext::ExecuteTaskInternal(ClientContextLock &lock, BaseQueryResult &result,
@@ -716,6 +779,17 @@ unique_ptr<QueryResult> ClientContext::Execute(const string &query, shared_ptr<P
 unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientContextLock &lock, const string &query,
                                                                        unique_ptr<SQLStatement> statement,
                                                                        const PendingQueryParameters &parameters) {
+	if (statement->type == StatementType::SET_STATEMENT || statement->type == StatementType::VARIABLE_SET_STATEMENT) {
+		// settings and variables can change the result of a query
+		client_data->result_cache->Clear();
+	}
+	auto cache_key = QueryResultCache::GetCacheKey(*this, statement->type, *statement, parameters.parameters);
+	if (!cache_key.empty()) {
+		auto cached_result = client_data->result_cache->Lookup(*this, cache_key);
+		if (cached_result) {
+			return PendingCachedResultInternal(lock, std::move(cached_result), parameters);
+		}
+	}
 	// prepare the query for execution
 	auto prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
 	                                        PreparedStatementMode::PREPARE_AND_EXECUTE);
@@ -730,7 +804,13 @@ unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientCon
 	}
 	// execute the prepared statement
 	CheckIfPreparedStatementIsExecutable(*prepared);
-	return PendingPreparedStatementInternal(lock, std::move(prepared), parameters);
+	auto result_cacheable = prepared->result_cacheable;
+	auto pending = PendingPreparedStatementInternal(lock, std::move(prepared), parameters);
+	if (!cache_key.empty() && result_cacheable) {
+		client_data->result_cache->RegisterMiss();
+		active_query->result_cache_key = std::move(cache_key);
+	}
+	return pending;
 }
 
 unique_ptr<QueryResult> ClientContext::RunStatementInternal(ClientContextLock &lock, const string &query,
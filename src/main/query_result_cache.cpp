@@ -0,0 +1,222 @@
+#include "duckdb/main/query_result_cache.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+#include "duckdb/parser/statement/execute_statement.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_execute.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/meta_transaction.hpp"
+
+namespace duckdb {
+
+QueryResultCache::QueryResultCache() : memory_usage(0), hits(0), misses(0) {
+}
+
+string QueryResultCache::GetCacheKey(ClientContext &context, StatementType statement_type,
+                                     const SQLStatement &statement,
+                                     optional_ptr<case_insensitive_map_t<Value>> parameters) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (config.result_cache_memory_limit == 0 || config.AnyVerification()) {
+		return string();
+	}
+	if (statement_type == StatementType::EXECUTE_STATEMENT) {
+		return GetExecuteCacheKey(context, statement.Cast<ExecuteStatement>());
+	}
+	if (statement_type != StatementType::SELECT_STATEMENT) {
+		return string();
+	}
+	auto result = statement.ToString();
+	if (parameters) {
+		// the parameters are part of the key - sort them so the key does not depend on the order of the map
+		vector<string> parameter_keys;
+		for (auto &entry : *parameters) {
+			parameter_keys.push_back(entry.first + "=" + entry.second.type().ToString() + ":" +
+			                         entry.second.ToSQLString());
+		}
+		std::sort(parameter_keys.begin(), parameter_keys.end());
+		for (auto &parameter_key : parameter_keys) {
+			result += "\n" + parameter_key;
+		}
+	}
+	return result;
+}
+
+string QueryResultCache::GetExecuteCacheKey(ClientContext &context, const ExecuteStatement &statement) {
+	auto &prepared_statements = ClientData::Get(context).prepared_statements;
+	auto entry = prepared_statements.find(statement.name);
+	if (entry == prepared_statements.end() || entry->second->statement_type != StatementType::SELECT_STATEMENT) {
+		return string();
+	}
+	// the key is the query of the prepared statement together with the values of its parameters
+	case_insensitive_map_t<Value> parameters;
+	for (auto &value : statement.named_values) {
+		if (value.second->GetExpressionClass() != ExpressionClass::CONSTANT) {
+			return string();
+		}
+		parameters[value.first] = value.second->Cast<ConstantExpression>().value;
+	}
+	return GetCacheKey(context, StatementType::SELECT_STATEMENT, *entry->second->unbound_statement, &parameters);
+}
+
+static bool GetDependenciesRecursive(LogicalOperator &plan, vector<shared_ptr<DataTableInfo>> &result) {
+	switch (plan.type) {
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+		return false;
+	case LogicalOperatorType::LOGICAL_EXECUTE: {
+		// the dependencies were collected when the statement was prepared
+		auto &prepared = *plan.Cast<LogicalExecute>().prepared;
+		if (!prepared.result_cacheable) {
+			return false;
+		}
+		result.insert(result.end(), prepared.result_cache_tables.begin(), prepared.result_cache_tables.end());
+		return true;
+	}
+	case LogicalOperatorType::LOGICAL_GET: {
+		// we can only cache results of scans over tables whose commits we can track
+		auto &get = plan.Cast<LogicalGet>();
+		auto table = get.GetTable();
+		if (!table || !table->IsDuckTable()) {
+			return false;
+		}
+		result.push_back(table->Cast<DuckTableEntry>().GetStorage().info);
+		break;
+	}
+	default:
+		break;
+	}
+	bool cacheable = true;
+	LogicalOperatorVisitor::EnumerateExpressions(plan, [&](unique_ptr<Expression> *child) {
+		auto &expr = **child;
+		if (expr.IsVolatile() || !expr.IsConsistent()) {
+			cacheable = false;
+		}
+	});
+	if (!cacheable) {
+		return false;
+	}
+	for (auto &child : plan.children) {
+		if (!GetDependenciesRecursive(*child, result)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool QueryResultCache::GetDependencies(LogicalOperator &plan, vector<shared_ptr<DataTableInfo>> &result) {
+	// results that do not depend on any table (e.g. the value of a setting) are not cached
+	return GetDependenciesRecursive(plan, result) && !result.empty();
+}
+
+bool QueryResultCache::IsValid(ClientContext &context, const CachedQueryResult &result) {
+	auto &meta_transaction = MetaTransaction::Get(context);
+	auto catalog_version = Catalog::GetSystemCatalog(context).GetCatalogVersion();
+	if (meta_transaction.catalog_version != catalog_version || result.catalog_version != catalog_version) {
+		return false;
+	}
+	for (auto &dependency : result.dependencies) {
+		auto &table = *dependency.table;
+		if (table.last_commit_id != dependency.commit_id) {
+			// the table was modified since the result was computed
+			return false;
+		}
+		auto &transaction = DuckTransaction::Get(context, table.db);
+		if (dependency.commit_id >= transaction.start_time || transaction.ChangesMade()) {
+			// the transaction does not see the same version of the table
+			return false;
+		}
+	}
+	return true;
+}
+
+shared_ptr<CachedQueryResult> QueryResultCache::Lookup(ClientContext &context, const string &key) {
+	auto entry = entries.find(key);
+	if (entry == entries.end()) {
+		return nullptr;
+	}
+	if (!IsValid(context, *entry->second.result)) {
+		Evict(entry);
+		return nullptr;
+	}
+	// move the entry to the front of the LRU list
+	lru.splice(lru.begin(), lru, entry->second.lru_position);
+	hits++;
+	return entry->second.result;
+}
+
+void QueryResultCache::Store(ClientContext &context, const string &key, const PreparedStatementData &statement,
+                             ColumnDataCollection &collection) {
+	auto memory_limit = ClientConfig::GetConfig(context).result_cache_memory_limit;
+	if (collection.SizeInBytes() > memory_limit) {
+		return;
+	}
+	auto result = make_shared<CachedQueryResult>();
+	result->catalog_version = Catalog::GetSystemCatalog(context).GetCatalogVersion();
+	if (MetaTransaction::Get(context).catalog_version != result->catalog_version) {
+		return;
+	}
+	for (auto &table : statement.result_cache_tables) {
+		CachedResultDependency dependency;
+		dependency.table = table;
+		dependency.commit_id = table->last_commit_id;
+		auto &transaction = DuckTransaction::Get(context, table->db);
+		if (dependency.commit_id >= transaction.start_time || transaction.ChangesMade()) {
+			// the result was computed on a snapshot that is not the latest committed version of the table
+			return;
+		}
+		result->dependencies.push_back(std::move(dependency));
+	}
+	result->properties = statement.properties;
+	result->names = statement.names;
+	result->types = statement.types;
+	// the results are kept in memory, so the memory usage of the cache is exactly the size of the results
+	result->collection = make_uniq<ColumnDataCollection>(Allocator::Get(context), statement.types);
+	for (auto &chunk : collection.Chunks()) {
+		result->collection->Append(chunk);
+	}
+	result->memory_usage = result->collection->AllocationSize();
+	if (result->memory_usage > memory_limit) {
+		return;
+	}
+
+	auto entry = entries.find(key);
+	if (entry != entries.end()) {
+		Evict(entry);
+	}
+	// evict the least recently used results until the new result fits
+	while (!lru.empty() && memory_usage + result->memory_usage > memory_limit) {
+		Evict(entries.find(lru.back()));
+	}
+	lru.push_front(key);
+	memory_usage += result->memory_usage;
+	CacheEntry new_entry;
+	new_entry.result = std::move(result);
+	new_entry.lru_position = lru.begin();
+	entries.insert(make_pair(key, std::move(new_entry)));
+}
+
+void QueryResultCache::Evict(unordered_map<string, CacheEntry>::iterator entry) {
+	D_ASSERT(entry != entries.end());
+	memory_usage -= entry->second.result->memory_usage;
+	lru.erase(entry->second.lru_position);
+	entries.erase(entry);
+}
+
+void QueryResultCache::Clear() {
+	entries.clear();
+	lru.clear();
+	memory_usage = 0;
+}
+
+} // namespace duckdb
@@ -9,6 +9,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
@@ -78,6 +79,22 @@ Value AllowPersistentSecrets::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(config.secret_manager->PersistentSecretsEnabled());
 }
 
+//===--------------------------------------------------------------------===//
+// Checkpoint Bloom Filters
+//===--------------------------------------------------------------------===//
+void CheckpointBloomFiltersSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.checkpoint_bloom_filters = input.GetValue<bool>();
+}
+
+void CheckpointBloomFiltersSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.checkpoint_bloom_filters = DBConfig().options.checkpoint_bloom_filters;
+}
+
+Value CheckpointBloomFiltersSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.checkpoint_bloom_filters);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -861,6 +878,42 @@ Value HomeDirectorySetting::GetSetting(ClientContext &context) {
 	return Value(config.home_directory);
 }
 
+//===--------------------------------------------------------------------===//
+// Index Scan Max Count
+//===--------------------------------------------------------------------===//
+void IndexScanMaxCountSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.index_scan_max_count = input.GetValue<idx_t>();
+}
+
+void IndexScanMaxCountSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.index_scan_max_count = DBConfig().options.index_scan_max_count;
+}
+
+Value IndexScanMaxCountSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.index_scan_max_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Index Scan Percentage
+//===--------------------------------------------------------------------===//
+void IndexScanPercentageSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto percentage = input.GetValue<double>();
+	if (percentage < 0 || percentage > 1) {
+		throw InvalidInputException("The index scan percentage must be within the range 0 - 1");
+	}
+	config.options.index_scan_percentage = percentage;
+}
+
+void IndexScanPercentageSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.index_scan_percentage = DBConfig().options.index_scan_percentage;
+}
+
+Value IndexScanPercentageSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::DOUBLE(config.options.index_scan_percentage);
+}
+
 //===--------------------------------------------------------------------===//
 // Integer Division
 //===--------------------------------------------------------------------===//
@@ -1037,6 +1090,23 @@ Value PerfectHashThresholdSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).perfect_ht_threshold);
 }
 
+//===--------------------------------------------------------------------===//
+// Pin Threads
+//===--------------------------------------------------------------------===//
+void PinThreadsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	// the threads are (un)pinned when they are relaunched after the query
+	config.options.pin_threads = input.GetValue<bool>();
+}
+
+void PinThreadsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.pin_threads = DBConfig().options.pin_threads;
+}
+
+Value PinThreadsSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.pin_threads);
+}
+
 //===--------------------------------------------------------------------===//
 // Pivot Filter Threshold
 //===--------------------------------------------------------------------===//
@@ -1189,6 +1259,27 @@ Value ProgressBarTimeSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Result Cache Memory Limit
+//===--------------------------------------------------------------------===//
+void ResultCacheMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).result_cache_memory_limit = ClientConfig().result_cache_memory_limit;
+	ClientData::Get(context).result_cache->Clear();
+}
+
+void ResultCacheMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto limit = DBConfig::ParseMemoryLimit(input.ToString());
+	if (limit == DConstants::INVALID_INDEX) {
+		throw InvalidInputException("The result cache requires a memory limit, use 0 to disable it");
+	}
+	ClientConfig::GetConfig(context).result_cache_memory_limit = limit;
+	ClientData::Get(context).result_cache->Clear();
+}
+
+Value ResultCacheMemoryLimitSetting::GetSetting(ClientContext &context) {
+	return Value(StringUtil::BytesToHumanReadableString(ClientConfig::GetConfig(context).result_cache_memory_limit));
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1246,6 +1337,34 @@ Value SecretDirectorySetting::GetSetting(ClientContext &context) {
 	return config.secret_manager->PersistentSecretPath();
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto compression = StringUtil::Lower(input.ToString());
+	if (compression == "uncompressed" || compression == "none") {
+		config.options.temporary_compression = TemporaryCompressionType::UNCOMPRESSED;
+	} else if (compression == "lz4") {
+		config.options.temporary_compression = TemporaryCompressionType::LZ4;
+	} else {
+		throw ParserException("Unrecognized option for temp_file_compression, expected uncompressed or lz4");
+	}
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temporary_compression = DBConfig().options.temporary_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.temporary_compression) {
+	case TemporaryCompressionType::LZ4:
+		return Value("lz4");
+	default:
+		return Value("uncompressed");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Temp Directory
 //===--------------------------------------------------------------------===//
@@ -11,6 +11,7 @@
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
@@ -569,12 +570,6 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 			auto &fst_const_value_expr = func.children[1]->Cast<BoundConstantExpression>();
 			auto &type = fst_const_value_expr.value.type();
 
-			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
-			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
-			if (!type.IsIntegral()) {
-				continue;
-			}
-
 			bool can_simplify_in_clause = true;
 			for (idx_t i = 1; i < func.children.size(); i++) {
 				auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
@@ -582,21 +577,48 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 					can_simplify_in_clause = false;
 					break;
 				}
-				in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
 			}
-			if (!can_simplify_in_clause || in_values.empty()) {
+			if (!can_simplify_in_clause) {
 				continue;
 			}
 
-			sort(in_values.begin(), in_values.end());
+			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
+			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
+			if (type.IsIntegral()) {
+				for (idx_t i = 1; i < func.children.size(); i++) {
+					auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
+					in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
+				}
+				sort(in_values.begin(), in_values.end());
 
-			for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
-				if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
-					can_simplify_in_clause = false;
-					break;
+				for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
+					if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
+						can_simplify_in_clause = false;
+						break;
+					}
 				}
+			} else {
+				can_simplify_in_clause = false;
 			}
 			if (!can_simplify_in_clause) {
+				//! Otherwise, a short IN list is pushed as an OR of equality filters
+				// e.g. if we have x IN (1, 10, 100) we push x = 1 OR x = 10 OR x = 100 into the scan, which can then
+				// use the zonemaps (or e.g. Parquet Bloom filters) to skip data that contains none of the values
+				if (func.children.size() - 1 > MAX_IN_LIST_PUSHDOWN_SIZE ||
+				    !(TypeIsNumeric(type.InternalType()) || type.InternalType() == PhysicalType::VARCHAR ||
+				      type.InternalType() == PhysicalType::BOOL)) {
+					continue;
+				}
+				auto or_filter = make_uniq<ConjunctionOrFilter>();
+				for (idx_t i = 1; i < func.children.size(); i++) {
+					auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
+					or_filter->child_filters.push_back(
+					    make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, const_value_expr.value));
+				}
+				table_filters.PushFilter(column_index, std::move(or_filter));
+				table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
+
+				remaining_filters.erase(remaining_filters.begin() + rem_fil_idx);
 				continue;
 			}
 			auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
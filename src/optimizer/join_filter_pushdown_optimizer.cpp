@@ -0,0 +1,116 @@
+#include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+void JoinFilterPushdownOptimizer::GetPushdownFilterTargets(LogicalOperator &op,
+                                                           vector<JoinFilterPushdownColumn> columns,
+                                                           vector<PushdownFilterTarget> &targets) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		// the filters can only be pushed through a projection if the columns are projected as-is
+		auto &proj = op.Cast<LogicalProjection>();
+		for (auto &column : columns) {
+			D_ASSERT(column.probe_column.table_index == proj.table_index);
+			auto &expr = *proj.expressions[column.probe_column.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			column.probe_column = expr.Cast<BoundColumnRefExpression>().binding;
+		}
+		GetPushdownFilterTargets(*op.children[0], std::move(columns), targets);
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+		// filters do not change the column bindings
+		GetPushdownFilterTargets(*op.children[0], std::move(columns), targets);
+		break;
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+		// the probe side of another join is streamed through that join: push into its scans if the columns come
+		// from the left side
+		auto left_bindings = op.children[0]->GetColumnBindings();
+		for (auto &column : columns) {
+			if (std::find(left_bindings.begin(), left_bindings.end(), column.probe_column) == left_bindings.end()) {
+				return;
+			}
+		}
+		GetPushdownFilterTargets(*op.children[0], std::move(columns), targets);
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (!get.function.filter_pushdown || !get.children.empty() ||
+		    get.function.global_initialization != TableFunctionInitialization::INITIALIZE_ON_EXECUTE) {
+			// the filters can only be pushed into scans that initialize after the build side is finished
+			return;
+		}
+		for (auto &column : columns) {
+			D_ASSERT(column.probe_column.table_index == get.table_index);
+			auto column_index = column.probe_column.column_index;
+			if (column_index >= get.column_ids.size() || get.column_ids[column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+				return;
+			}
+		}
+		if (!get.dynamic_filters) {
+			get.dynamic_filters = make_shared<DynamicTableFilterSet>();
+		}
+		targets.emplace_back(get.dynamic_filters, std::move(columns));
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &join) {
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::RIGHT:
+	case JoinType::SEMI:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		// rows on the probe side without a join partner are not part of the result for these joins
+		break;
+	default:
+		return;
+	}
+	auto pushdown_info = make_uniq<JoinFilterPushdownInfo>();
+	vector<JoinFilterPushdownColumn> pushdown_columns;
+	for (idx_t cond_idx = 0; cond_idx < join.conditions.size(); cond_idx++) {
+		auto &cond = join.conditions[cond_idx];
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL || cond.left->type != ExpressionType::BOUND_COLUMN_REF) {
+			continue;
+		}
+		if (!JoinFilterPushdownInfo::SupportsBloomFilter(cond.left->return_type)) {
+			continue;
+		}
+		JoinFilterPushdownColumn pushdown_column;
+		pushdown_column.join_condition = cond_idx;
+		pushdown_column.probe_column = cond.left->Cast<BoundColumnRefExpression>().binding;
+		pushdown_columns.push_back(pushdown_column);
+		pushdown_info->join_condition.push_back(cond_idx);
+	}
+	if (pushdown_columns.empty()) {
+		return;
+	}
+	GetPushdownFilterTargets(*join.children[0], std::move(pushdown_columns), pushdown_info->probe_info);
+	if (pushdown_info->probe_info.empty()) {
+		return;
+	}
+	join.filter_pushdown = std::move(pushdown_info);
+}
+
+void JoinFilterPushdownOptimizer::VisitOperator(LogicalOperator &op) {
+	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		GenerateJoinFilters(op.Cast<LogicalComparisonJoin>());
+	}
+	LogicalOperatorVisitor::VisitOperatorChildren(op);
+}
+
+} // namespace duckdb
@@ -0,0 +1,66 @@
+#include "duckdb/optimizer/late_materialization.hpp"
+
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+
+namespace duckdb {
+
+void LateMaterialization::VisitOperator(LogicalOperator &op) {
+	if (op.type == LogicalOperatorType::LOGICAL_TOP_N) {
+		auto &top_n = op.Cast<LogicalTopN>();
+		top_n.late_materialization = CanLateMaterialize(top_n);
+	}
+	VisitOperatorChildren(op);
+}
+
+bool LateMaterialization::CanLateMaterialize(LogicalTopN &top_n) {
+	if (top_n.limit < 0 || top_n.offset < 0 || idx_t(top_n.limit) > MAX_ROW_COUNT ||
+	    idx_t(top_n.limit + top_n.offset) > MAX_ROW_COUNT) {
+		// fetching rows one-by-one only pays off for small limits
+		return false;
+	}
+	// gather the columns that are referenced by the sort keys
+	column_binding_set_t key_columns;
+	for (auto &order : top_n.orders) {
+		ExpressionIterator::EnumerateExpression(order.expression, [&](Expression &expr) {
+			if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+				key_columns.insert(expr.Cast<BoundColumnRefExpression>().binding);
+			}
+		});
+	}
+	// trace them through projections down to the table scan
+	reference<LogicalOperator> child = *top_n.children[0];
+	while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		auto &proj = child.get().Cast<LogicalProjection>();
+		for (auto &expr : proj.expressions) {
+			if (expr->type != ExpressionType::BOUND_COLUMN_REF) {
+				// every column that is emitted has to be fetched from the table
+				return false;
+			}
+		}
+		column_binding_set_t child_key_columns;
+		for (auto &binding : key_columns) {
+			D_ASSERT(binding.table_index == proj.table_index);
+			child_key_columns.insert(proj.expressions[binding.column_index]->Cast<BoundColumnRefExpression>().binding);
+		}
+		key_columns = std::move(child_key_columns);
+		child = *proj.children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (get.function.name != "seq_scan" || !get.bind_data || !get.children.empty() || get.dynamic_filters) {
+		// only plain scans of DuckDB tables can fetch rows by their row id
+		return false;
+	}
+	// this only pays off if there are columns that do not have to be scanned
+	auto column_count = get.projection_ids.empty() ? get.column_ids.size() : get.projection_ids.size();
+	return key_columns.size() < column_count;
+}
+
+} // namespace duckdb
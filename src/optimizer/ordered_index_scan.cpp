@@ -0,0 +1,138 @@
+#include "duckdb/optimizer/ordered_index_scan.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+#include "duckdb/transaction/transaction.hpp"
+
+namespace duckdb {
+
+OrderedIndexScan::OrderedIndexScan(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+unique_ptr<LogicalOperator> OrderedIndexScan::Optimize(unique_ptr<LogicalOperator> op) {
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	if (op->type == LogicalOperatorType::LOGICAL_ORDER_BY && TryOrderIndexScan(op->Cast<LogicalOrder>())) {
+		// the rows arrive in the requested order: the ORDER BY is not needed
+		return std::move(op->children[0]);
+	}
+	return op;
+}
+
+//! Returns the table column of the key column at position key_idx, or an invalid index for expression keys
+static optional_idx GetKeyColumn(ART &index, idx_t key_idx) {
+	auto &expr = *index.unbound_expressions[key_idx];
+	if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+		return optional_idx();
+	}
+	return index.column_ids[expr.Cast<BoundColumnRefExpression>().binding.column_index];
+}
+
+bool OrderedIndexScan::TryOrderIndexScan(LogicalOrder &order) {
+	if (!order.projections.empty()) {
+		// the ORDER BY also removes columns
+		return false;
+	}
+	auto &context = optimizer.context;
+	if (!DBConfig::GetConfig(context).options.preserve_insertion_order) {
+		return false;
+	}
+	// the index emits its keys in ascending order, and never emits NULL keys
+	vector<ColumnBinding> bindings;
+	for (auto &node : order.orders) {
+		if (node.type != OrderType::ASCENDING || node.expression->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		bindings.push_back(node.expression->Cast<BoundColumnRefExpression>().binding);
+	}
+	// trace the sort keys down to the table scan that produces them
+	reference<LogicalOperator> child = *order.children[0];
+	while (true) {
+		if (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+			auto &proj = child.get().Cast<LogicalProjection>();
+			for (auto &binding : bindings) {
+				D_ASSERT(binding.table_index == proj.table_index);
+				auto &expr = *proj.expressions[binding.column_index];
+				if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+					return false;
+				}
+				binding = expr.Cast<BoundColumnRefExpression>().binding;
+			}
+		} else if (child.get().type != LogicalOperatorType::LOGICAL_FILTER) {
+			break;
+		}
+		child = *child.get().children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (get.function.name != "index_scan" || !get.bind_data) {
+		return false;
+	}
+	auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+	auto &storage = bind_data.table.GetStorage();
+	if (LocalStorage::Get(context, bind_data.table.catalog).AddedRows(storage) > 0) {
+		// the rows that were appended by the transaction are emitted after the rows of the index
+		return false;
+	}
+	auto index = TableScanFunction::GetScannedIndex(context, bind_data);
+	if (!index) {
+		return false;
+	}
+	auto &transaction = Transaction::Get(context, bind_data.table.catalog);
+	auto index_state = index->TryInitializeScan(transaction, bind_data.index_expressions, bind_data.index_filters);
+	if (!index_state) {
+		return false;
+	}
+
+	// the sort keys have to be the key columns that follow the equality predicates, in order
+	// the bindings of the scan can have changed since the filters were pushed down: compare the table columns
+	auto key_count = index->unbound_expressions.size();
+	auto prefix_count = index_state->Cast<ARTIndexScanState>().prefix_values.size();
+	auto key_idx = prefix_count;
+	for (auto &binding : bindings) {
+		if (binding.table_index != get.table_index) {
+			return false;
+		}
+		auto column_id = get.column_ids[binding.column_index];
+		bool is_prefix_column = false;
+		for (idx_t i = 0; i < prefix_count; i++) {
+			auto key_column = GetKeyColumn(*index, i);
+			if (key_column.IsValid() && key_column.GetIndex() == column_id) {
+				// the key column has a single value: sorting on it is a no-op
+				is_prefix_column = true;
+				break;
+			}
+		}
+		if (is_prefix_column) {
+			continue;
+		}
+		if (key_idx >= key_count) {
+			return false;
+		}
+		auto key_column = GetKeyColumn(*index, key_idx);
+		if (!key_column.IsValid() || key_column.GetIndex() != column_id) {
+			return false;
+		}
+		key_idx++;
+	}
+
+	bind_data.index_scan_ordered = true;
+	// whether or not the transaction has appended rows to the table can change before the plan is executed again
+	optimizer.binder.SetAlwaysRequireRebind();
+	return true;
+}
+
+} // namespace duckdb
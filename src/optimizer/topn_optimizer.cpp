@@ -1,8 +1,13 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
@@ -25,6 +30,91 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+static bool SupportsDynamicFilter(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void TopN::PushdownDynamicFilters(LogicalTopN &op) {
+	auto &order = op.orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		// NULL values sort before the boundary: they can never be filtered out
+		return;
+	}
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF ||
+	    !SupportsDynamicFilter(order.expression->return_type)) {
+		return;
+	}
+	// trace the sort key down to the table scan that produces it
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+	reference<LogicalOperator> child = *op.children[0];
+	while (true) {
+		if (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+			auto &proj = child.get().Cast<LogicalProjection>();
+			D_ASSERT(binding.table_index == proj.table_index);
+			auto &expr = *proj.expressions[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+		} else if (child.get().type != LogicalOperatorType::LOGICAL_FILTER) {
+			break;
+		}
+		child = *child.get().children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return;
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (!get.function.filter_pushdown || !get.children.empty()) {
+		return;
+	}
+	D_ASSERT(binding.table_index == get.table_index);
+	auto column_id = get.column_ids[binding.column_index];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return;
+	}
+	// the rows that are kept are the ones that are at least as good as the boundary
+	auto comparison_type = order.type == OrderType::ASCENDING ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+	                                                          : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	op.dynamic_filter = make_shared<DynamicFilterData>(comparison_type, order.expression->return_type);
+	auto dynamic_filter = make_uniq<DynamicFilter>(op.dynamic_filter);
+
+	auto &filters = get.table_filters.filters;
+	auto entry = filters.find(column_id);
+	if (entry == filters.end()) {
+		filters[column_id] = std::move(dynamic_filter);
+	} else {
+		auto conjunction = make_uniq<ConjunctionAndFilter>();
+		conjunction->child_filters.push_back(std::move(entry->second));
+		conjunction->child_filters.push_back(std::move(dynamic_filter));
+		entry->second = std::move(conjunction);
+	}
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (CanOptimize(*op)) {
 		auto &limit = op->Cast<LogicalLimit>();
@@ -36,6 +126,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 		}
 		auto topn = make_uniq<LogicalTopN>(std::move(order_by.orders), limit_val, offset_val);
 		topn->AddChild(std::move(order_by.children[0]));
+		PushdownDynamicFilters(*topn);
 		op = std::move(topn);
 	} else {
 		for (auto &child : op->children) {
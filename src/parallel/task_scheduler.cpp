@@ -1,7 +1,11 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -11,15 +15,104 @@
 #include "lightweightsemaphore.h"
 
 #include <thread>
+#ifdef __linux__
+#include <cinttypes>
+#include <pthread.h>
+#include <sched.h>
+#endif
 #else
 #include <queue>
 #endif
 
 namespace duckdb {
 
+//! A task in the local queue of a worker thread, together with the producer that scheduled it
+struct LocalTask {
+	reference<ProducerToken> producer;
+	shared_ptr<Task> task;
+};
+
+//! The local task queue of a background thread. The owning thread pushes and pops tasks at the back of the queue,
+//! other threads steal tasks from the front.
+struct WorkerQueue {
+	explicit WorkerQueue(idx_t thread_id)
+	    : thread_id(thread_id), socket(0), size(0), tasks_executed(0), tasks_stolen(0), idle_time(0) {
+	}
+
+	//! The index of the worker thread
+	idx_t thread_id;
+	//! The CPU the thread is pinned to (if any), and the socket of that CPU
+	optional_idx cpu;
+	atomic<idx_t> socket;
+	mutex lock;
+	deque<LocalTask> tasks;
+	//! The amount of tasks in the queue - allows other threads to skip empty queues without locking them
+	atomic<idx_t> size;
+	atomic<idx_t> tasks_executed;
+	atomic<idx_t> tasks_stolen;
+	//! The time (in microseconds) the thread spent waiting for tasks
+	atomic<idx_t> idle_time;
+
+public:
+	void Push(ProducerToken &producer, shared_ptr<Task> task) {
+		lock_guard<mutex> guard(lock);
+		tasks.push_back(LocalTask {producer, std::move(task)});
+		size++;
+	}
+
+	bool PopBack(shared_ptr<Task> &task) {
+		if (size == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.back().task);
+		tasks.pop_back();
+		size--;
+		return true;
+	}
+
+	bool StealFront(shared_ptr<Task> &task) {
+		if (size == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.front().task);
+		tasks.pop_front();
+		size--;
+		return true;
+	}
+
+	bool StealFromProducer(ProducerToken &producer, shared_ptr<Task> &task) {
+		if (size == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		for (auto it = tasks.begin(); it != tasks.end(); it++) {
+			if (&it->producer.get() == &producer) {
+				task = std::move(it->task);
+				tasks.erase(it);
+				size--;
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+struct WorkerQueueSet {
+	vector<shared_ptr<WorkerQueue>> queues;
+};
+
 struct SchedulerThread {
 #ifndef DUCKDB_NO_THREADS
-	explicit SchedulerThread(unique_ptr<thread> thread_p) : internal_thread(std::move(thread_p)) {
+	SchedulerThread(unique_ptr<thread> thread_p, shared_ptr<WorkerQueue> worker_queue_p)
+	    : internal_thread(std::move(thread_p)), worker_queue(std::move(worker_queue_p)) {
 	}
 
 	~SchedulerThread() {
@@ -27,6 +120,7 @@ struct SchedulerThread {
 	}
 
 	unique_ptr<thread> internal_thread;
+	shared_ptr<WorkerQueue> worker_queue;
 #endif
 };
 
@@ -100,10 +194,16 @@ ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerT
 ProducerToken::~ProducerToken() {
 }
 
+#ifndef DUCKDB_NO_THREADS
+//! The scheduler and the local task queue of the current thread, if it is a background thread
+static thread_local TaskScheduler *current_scheduler = nullptr;
+static thread_local WorkerQueue *current_worker = nullptr;
+#endif
+
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
-      allocator_flush_threshold(db.config.options.allocator_flush_threshold), requested_thread_count(0),
-      current_thread_count(1) {
+    : db(db), queue(make_uniq<ConcurrentQueue>()), worker_queues(make_shared<WorkerQueueSet>()),
+      threads_pinned(false), allocator_flush_threshold(db.config.options.allocator_flush_threshold),
+      requested_thread_count(0), current_thread_count(1) {
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -125,23 +225,97 @@ unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
 	return make_uniq<ProducerToken>(*this, std::move(token));
 }
 
+optional_ptr<WorkerQueue> TaskScheduler::GetCurrentWorker() {
+#ifndef DUCKDB_NO_THREADS
+	if (current_scheduler == this) {
+		return current_worker;
+	}
+#endif
+	return nullptr;
+}
+
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
+#ifndef DUCKDB_NO_THREADS
+	auto worker = GetCurrentWorker();
+	if (worker) {
+		// tasks scheduled by a background thread go to its local queue - signal any sleeping threads so they can steal
+		worker->Push(token, std::move(task));
+		queue->semaphore.signal();
+		return;
+	}
+#endif
 	// Enqueue a task for the given producer token and signal any sleeping threads
 	queue->Enqueue(token, std::move(task));
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	if (queue->DequeueFromProducer(token, task)) {
+		return true;
+	}
+#ifndef DUCKDB_NO_THREADS
+	// the task might have been scheduled by a background thread: look in the local queues
+	auto workers = std::atomic_load(&worker_queues);
+	for (auto &worker : workers->queues) {
+		if (worker->StealFromProducer(token, task)) {
+			return true;
+		}
+	}
+#endif
+	return false;
+}
+
+bool TaskScheduler::GetTask(shared_ptr<Task> &task, optional_ptr<WorkerQueue> worker) {
+#ifndef DUCKDB_NO_THREADS
+	// the most recently scheduled task of the local queue is the most likely to still be in the cache
+	if (worker && worker->PopBack(task)) {
+		return true;
+	}
+	if (queue->q.try_dequeue(task)) {
+		return true;
+	}
+	// steal the oldest task of another thread - first from the threads on the same socket, then from the others
+	auto workers = std::atomic_load(&worker_queues);
+	auto &queues = workers->queues;
+	idx_t offset = worker ? worker->thread_id + 1 : 0;
+	for (idx_t pass = 0; pass < 2; pass++) {
+		for (idx_t i = 0; i < queues.size(); i++) {
+			auto &victim = *queues[(offset + i) % queues.size()];
+			if (worker && &victim == worker.get()) {
+				continue;
+			}
+			bool same_socket = !worker || victim.socket == worker->socket;
+			if (same_socket != (pass == 0)) {
+				continue;
+			}
+			if (victim.StealFront(task)) {
+				if (worker) {
+					worker->tasks_stolen++;
+				}
+				return true;
+			}
+		}
+	}
+#endif
+	return false;
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
+	auto worker = GetCurrentWorker();
 	shared_ptr<Task> task;
 	// loop until the marker is set to false
 	while (*marker) {
-		// wait for a signal with a timeout
-		queue->semaphore.wait();
-		if (queue->q.try_dequeue(task)) {
+		if (!GetTask(task, worker)) {
+			// no tasks available: wait for a signal
+			auto start = std::chrono::steady_clock::now();
+			queue->semaphore.wait();
+			if (worker) {
+				auto idle_time = duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+				worker->idle_time += NumericCast<idx_t>(idle_time);
+			}
+			continue;
+		}
+		{
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -157,10 +331,22 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				break;
 			}
 
+			if (worker) {
+				worker->tasks_executed++;
+			}
 			// Flushes the outstanding allocator's outstanding allocations
 			Allocator::ThreadFlush(allocator_flush_threshold);
 		}
 	}
+	if (worker) {
+		// the thread is stopped: move the tasks that are left in its local queue to the global queue
+		lock_guard<mutex> guard(worker->lock);
+		for (auto &local_task : worker->tasks) {
+			queue->Enqueue(local_task.producer, std::move(local_task.task));
+		}
+		worker->tasks.clear();
+		worker->size = 0;
+	}
 #else
 	throw NotImplementedException("DuckDB was compiled without threads! Background thread loop is not allowed.");
 #endif
@@ -172,7 +358,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!GetTask(task, GetCurrentWorker())) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -202,7 +388,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!GetTask(task, GetCurrentWorker())) {
 			return;
 		}
 		try {
@@ -229,7 +415,9 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, WorkerQueue *worker_queue) {
+	current_scheduler = scheduler;
+	current_worker = worker_queue;
 	scheduler->ExecuteForever(marker);
 }
 #endif
@@ -279,9 +467,12 @@ void TaskScheduler::RelaunchThreads() {
 void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 #ifndef DUCKDB_NO_THREADS
 	auto &config = DBConfig::GetConfig(db);
-	idx_t new_thread_count = n;
+	idx_t new_thread_count = NumericCast<idx_t>(n);
 	if (threads.size() == new_thread_count) {
 		current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
+		if (threads_pinned != config.options.pin_threads) {
+			PinThreads(config.options.pin_threads);
+		}
 		return;
 	}
 	if (threads.size() > new_thread_count) {
@@ -291,35 +482,137 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		}
 		Signal(threads.size());
 		// now join the threads to ensure they are fully stopped before erasing them
+		// the threads move the tasks that are left in their local queues to the global queue before stopping
 		for (idx_t i = 0; i < threads.size(); i++) {
 			threads[i]->internal_thread->join();
 		}
 		// erase the threads/markers
 		threads.clear();
 		markers.clear();
+		std::atomic_store(&worker_queues, make_shared<WorkerQueueSet>());
 	}
 	if (threads.size() < new_thread_count) {
-		// we are increasing the number of threads: launch them and run tasks on them
+		// we are increasing the number of threads: publish their local queues, then launch them
+		auto new_queues = make_shared<WorkerQueueSet>(*std::atomic_load(&worker_queues));
+		for (idx_t i = threads.size(); i < new_thread_count; i++) {
+			new_queues->queues.push_back(make_shared<WorkerQueue>(i));
+		}
+		std::atomic_store(&worker_queues, new_queues);
+
 		idx_t create_new_threads = new_thread_count - threads.size();
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
+			auto worker_queue = new_queues->queues[threads.size()];
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), worker_queue.get());
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
 				break;
 			}
-			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread));
+			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread), std::move(worker_queue));
 
 			threads.push_back(std::move(thread_wrapper));
 			markers.push_back(std::move(marker));
 		}
+		if (threads.size() < new_queues->queues.size()) {
+			// not all threads could be launched: only keep the queues of the threads that are running
+			auto launched_queues = make_shared<WorkerQueueSet>();
+			for (auto &scheduler_thread : threads) {
+				launched_queues->queues.push_back(scheduler_thread->worker_queue);
+			}
+			std::atomic_store(&worker_queues, std::move(launched_queues));
+		}
 	}
+	PinThreads(config.options.pin_threads);
 	current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 #endif
 }
 
+#if !defined(DUCKDB_NO_THREADS) && defined(__linux__)
+static idx_t GetCPUSocket(FileSystem &fs, idx_t cpu) {
+	auto path = StringUtil::Format("/sys/devices/system/cpu/cpu%llu/topology/physical_package_id", cpu);
+	try {
+		if (!fs.FileExists(path)) {
+			return 0;
+		}
+		char byte_buffer[32];
+		auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+		auto read_bytes = fs.Read(*handle, (void *)byte_buffer, sizeof(byte_buffer) - 1);
+		byte_buffer[read_bytes] = '\0';
+		int64_t socket;
+		if (std::sscanf(byte_buffer, "%" SCNd64 "", &socket) != 1 || socket < 0) {
+			return 0;
+		}
+		return NumericCast<idx_t>(socket);
+	} catch (std::exception &ex) {
+		// the topology is not available (e.g. because file system access is disabled)
+		return 0;
+	}
+}
+#endif
+
+void TaskScheduler::PinThreads(bool pin) {
+#if !defined(DUCKDB_NO_THREADS) && defined(__linux__)
+	if (!pin && !threads_pinned) {
+		return;
+	}
+	// the CPUs the process is allowed to run on, ordered by socket so that consecutive threads share a socket
+	cpu_set_t available;
+	CPU_ZERO(&available);
+	if (sched_getaffinity(0, sizeof(available), &available) != 0) {
+		return;
+	}
+	vector<pair<idx_t, idx_t>> cpus;
+	if (pin) {
+		auto &fs = FileSystem::GetFileSystem(db);
+		for (idx_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+			if (CPU_ISSET(cpu, &available)) {
+				cpus.emplace_back(GetCPUSocket(fs, cpu), cpu);
+			}
+		}
+		std::sort(cpus.begin(), cpus.end());
+	}
+	for (idx_t i = 0; i < threads.size(); i++) {
+		auto &worker = *threads[i]->worker_queue;
+		auto mask = available;
+		if (!cpus.empty()) {
+			auto &cpu = cpus[i % cpus.size()];
+			CPU_ZERO(&mask);
+			CPU_SET(cpu.second, &mask);
+			worker.cpu = cpu.second;
+			worker.socket = cpu.first;
+		} else {
+			worker.cpu = optional_idx();
+			worker.socket = 0;
+		}
+		pthread_setaffinity_np(threads[i]->internal_thread->native_handle(), sizeof(mask), &mask);
+	}
+	threads_pinned = pin;
+#endif
+}
+
+vector<SchedulerThreadInfo> TaskScheduler::GetThreadInfo() {
+	vector<SchedulerThreadInfo> result;
+#ifndef DUCKDB_NO_THREADS
+	lock_guard<mutex> t(thread_lock);
+	for (auto &scheduler_thread : threads) {
+		auto &worker = *scheduler_thread->worker_queue;
+		SchedulerThreadInfo info;
+		info.thread_id = worker.thread_id;
+		info.cpu = worker.cpu;
+		if (worker.cpu.IsValid()) {
+			info.socket = worker.socket.load();
+		}
+		info.tasks_executed = worker.tasks_executed;
+		info.tasks_stolen = worker.tasks_stolen;
+		info.idle_time = worker.idle_time;
+		result.push_back(info);
+	}
+#endif
+	return result;
+}
+
 } // namespace duckdb
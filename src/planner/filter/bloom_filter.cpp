@@ -0,0 +1,72 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter(idx_t expected_count)
+    : BloomFilter(vector<uint64_t>(NextPowerOfTwo(MaxValue<idx_t>(expected_count * BITS_PER_KEY / 64, 1)), 0)) {
+}
+
+BloomFilter::BloomFilter(vector<uint64_t> blocks_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), blocks(std::move(blocks_p)) {
+	if (blocks.empty() || !IsPowerOfTwo(blocks.size())) {
+		throw InternalException("BloomFilter requires a power of two number of blocks");
+	}
+	block_mask = blocks.size() - 1;
+}
+
+void BloomFilter::InsertHashes(const hash_t *hashes, idx_t count) {
+	auto block_data = blocks.data();
+	for (idx_t i = 0; i < count; i++) {
+		block_data[hashes[i] & block_mask] |= GetMask(hashes[i]);
+	}
+}
+
+idx_t BloomFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                          idx_t &approved_tuple_count, idx_t scan_count) const {
+	// hash the values that are still selected, the hashes are written at the position of the value
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(scan_count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto vector_idx = vdata.sel->get_index(idx);
+		if (vdata.validity.RowIsValid(vector_idx) && LookupHash(hash_data[hdata.sel->get_index(idx)])) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	// min/max statistics tell us nothing about which hashes can occur
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER(" + to_string(blocks.size() * 64) + " bits)";
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(blocks);
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.blocks == blocks;
+}
+
+} // namespace duckdb
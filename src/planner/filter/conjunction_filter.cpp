@@ -30,6 +30,14 @@ string ConjunctionOrFilter::ToString(const string &column_name) {
 	return result;
 }
 
+unique_ptr<TableFilter> ConjunctionOrFilter::Copy() const {
+	auto result = make_uniq<ConjunctionOrFilter>();
+	for (auto &child_filter : child_filters) {
+		result->child_filters.push_back(child_filter->Copy());
+	}
+	return std::move(result);
+}
+
 bool ConjunctionOrFilter::Equals(const TableFilter &other_p) const {
 	if (!ConjunctionFilter::Equals(other_p)) {
 		return false;
@@ -75,6 +83,14 @@ string ConjunctionAndFilter::ToString(const string &column_name) {
 	return result;
 }
 
+unique_ptr<TableFilter> ConjunctionAndFilter::Copy() const {
+	auto result = make_uniq<ConjunctionAndFilter>();
+	for (auto &child_filter : child_filters) {
+		result->child_filters.push_back(child_filter->Copy());
+	}
+	return std::move(result);
+}
+
 bool ConjunctionAndFilter::Equals(const TableFilter &other_p) const {
 	if (!ConjunctionFilter::Equals(other_p)) {
 		return false;
@@ -0,0 +1,79 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+namespace duckdb {
+
+DynamicFilterData::DynamicFilterData(ExpressionType comparison_type, const LogicalType &type)
+    : filter(comparison_type, Value(type)) {
+}
+
+void DynamicFilterData::Tighten(const Value &constant) {
+	D_ASSERT(!constant.IsNull());
+	lock_guard<mutex> guard(lock);
+	if (initialized) {
+		switch (filter.comparison_type) {
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			if (constant <= filter.constant) {
+				return;
+			}
+			break;
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			if (constant >= filter.constant) {
+				return;
+			}
+			break;
+		default:
+			throw InternalException("Unsupported comparison type for DynamicFilterData");
+		}
+	}
+	filter.constant = constant;
+	initialized = true;
+}
+
+unique_ptr<ConstantFilter> DynamicFilterData::GetFilter() {
+	lock_guard<mutex> guard(lock);
+	if (!initialized) {
+		return nullptr;
+	}
+	return make_uniq<ConstantFilter>(filter.comparison_type, filter.constant);
+}
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter_data) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto filter = filter_data->GetFilter();
+	if (!filter) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	if (!filter_data) {
+		return column_name + " DYNAMIC_FILTER";
+	}
+	return column_name + ExpressionTypeToOperator(filter_data->filter.comparison_type) + "DYNAMIC_FILTER";
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data == filter_data;
+}
+
+} // namespace duckdb
@@ -9,6 +9,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/prepared_statement_data.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/expression/bound_parameter_expression.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
@@ -108,6 +109,10 @@ shared_ptr<PreparedStatementData> Planner::PrepareSQLStatement(unique_ptr<SQLSta
 	prepared_data->value_map = std::move(value_map);
 	prepared_data->properties = properties;
 	prepared_data->catalog_version = MetaTransaction::Get(context).catalog_version;
+	if (plan && prepared_data->statement_type == StatementType::SELECT_STATEMENT) {
+		prepared_data->result_cacheable =
+		    QueryResultCache::GetDependencies(*plan, prepared_data->result_cache_tables);
+	}
 	return prepared_data;
 }
 
@@ -34,7 +34,7 @@ BlockHandle::~BlockHandle() { // NOLINT: allow internal exceptions
 	if (buffer && buffer->type != FileBufferType::TINY_BUFFER) {
 		// we kill the latest version in the eviction queue
 		auto &buffer_manager = block_manager.buffer_manager;
-		buffer_manager.GetBufferPool().IncrementDeadNodes();
+		buffer_manager.GetBufferPool().IncrementDeadNodes(tag);
 	}
 
 	// no references remain to this block: erase
@@ -93,6 +93,18 @@ BufferHandle BlockHandle::Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileB
 	return BufferHandle(handle, handle->buffer.get());
 }
 
+BufferHandle BlockHandle::LoadFromBuffer(shared_ptr<BlockHandle> &handle, data_ptr_t data,
+                                         unique_ptr<FileBuffer> reusable_buffer) {
+	D_ASSERT(handle->state != BlockState::BLOCK_LOADED);
+	D_ASSERT(handle->block_id < MAXIMUM_BLOCK);
+	// copy over the contents of the block, including its header
+	auto block = AllocateBlock(handle->block_manager, std::move(reusable_buffer), handle->block_id);
+	memcpy(block->InternalBuffer(), data, block->AllocSize());
+	handle->buffer = std::move(block);
+	handle->state = BlockState::BLOCK_LOADED;
+	return BufferHandle(handle, handle->buffer.get());
+}
+
 unique_ptr<FileBuffer> BlockHandle::UnloadAndTakeBlock() {
 	if (state == BlockState::BLOCK_UNLOADED) {
 		// already unloaded: nothing to do
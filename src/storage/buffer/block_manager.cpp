@@ -63,7 +63,7 @@ shared_ptr<BlockHandle> BlockManager::ConvertToPersistent(block_id_t block_id, s
 	// potentially purge the queue
 	auto purge_queue = buffer_manager.GetBufferPool().AddToEvictionQueue(new_block);
 	if (purge_queue) {
-		buffer_manager.GetBufferPool().PurgeQueue();
+		buffer_manager.GetBufferPool().PurgeQueue(new_block->tag);
 	}
 
 	return new_block;
@@ -9,7 +9,63 @@ namespace duckdb {
 typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
 struct EvictionQueue {
+public:
+	EvictionQueue() : evict_queue_insertions(0), total_dead_nodes(0), hits(0), misses(0), evictions(0) {
+	}
+
+public:
+	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
+	//! ready to be purged, and false otherwise.
+	bool AddToEvictionQueue(BufferEvictionNode &&node);
+	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
+	bool TryDequeueWithLock(BufferEvictionNode &node);
+	//! Garbage collect dead nodes in the eviction queue.
+	void Purge();
+	//! Increment the dead node counter in the purge queue.
+	inline void IncrementDeadNodes() {
+		total_dead_nodes++;
+	}
+	//! Decrement the dead node counter in the purge queue.
+	inline void DecrementDeadNodes() {
+		total_dead_nodes--;
+	}
+
+private:
+	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
+	void PurgeIteration(const idx_t purge_size);
+
+public:
+	//! The concurrent queue
 	eviction_queue_t q;
+	//! The number of pins that found a block of this queue loaded
+	atomic<idx_t> hits;
+	//! The number of pins that had to load a block of this queue
+	atomic<idx_t> misses;
+	//! The number of blocks of this queue that were unloaded to free up memory
+	atomic<idx_t> evictions;
+
+private:
+	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
+	constexpr static idx_t INSERT_INTERVAL = 4096;
+	//! We multiply the base purge size by this value.
+	constexpr static idx_t PURGE_SIZE_MULTIPLIER = 2;
+	//! We multiply the purge size by this value to determine early-outs. This is the minimum queue size.
+	//! We never purge below this point.
+	constexpr static idx_t EARLY_OUT_MULTIPLIER = 4;
+	//! We multiply the approximate alive nodes by this value to test whether our total dead nodes
+	//! exceed their allowed ratio. Must be greater than 1.
+	constexpr static idx_t ALIVE_NODE_MULTIPLIER = 4;
+
+	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
+	atomic<idx_t> evict_queue_insertions;
+	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
+	//! handle, or (2) we insert a newer version into the eviction queue.
+	atomic<idx_t> total_dead_nodes;
+	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
+	//! Only lets a single thread enter the purge phase.
+	mutex purge_lock;
+	//! A pre-allocated vector of eviction nodes. We reuse this to keep the allocation overhead of purges small.
+	vector<BufferEvictionNode> purge_nodes;
 };
 
 bool BufferEvictionNode::CanUnload(BlockHandle &handle_p) {
@@ -34,16 +90,45 @@ shared_ptr<BlockHandle> BufferEvictionNode::TryGetBlockHandle() {
 	return handle_p;
 }
 
+// Persistent blocks (BASE_TABLE) can be dropped without writing them anywhere, and most CSV buffers can be re-read
+// from their source, so these are evicted first. Blocks of in-memory tables and indexes come next, and the
+// intermediates of running operators are evicted last, as these are likely to be needed again soon.
+const array<MemoryTag, MEMORY_TAG_COUNT> BufferPool::EVICTION_ORDER = {
+    {MemoryTag::BASE_TABLE, MemoryTag::CSV_READER, MemoryTag::PARQUET_READER, MemoryTag::METADATA,
+     MemoryTag::OVERFLOW_STRINGS, MemoryTag::ART_INDEX, MemoryTag::IN_MEMORY_TABLE, MemoryTag::COLUMN_DATA,
+     MemoryTag::EXTENSION, MemoryTag::ALLOCATOR, MemoryTag::ORDER_BY, MemoryTag::HASH_TABLE}};
+
 BufferPool::BufferPool(idx_t maximum_memory)
-    : current_memory(0), maximum_memory(maximum_memory), queue(make_uniq<EvictionQueue>()),
-      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()), evict_queue_insertions(0), total_dead_nodes(0) {
+    : current_memory(0), maximum_memory(maximum_memory),
+      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		memory_usage_per_tag[i] = 0;
+		queues.push_back(make_uniq<EvictionQueue>());
 	}
 }
 BufferPool::~BufferPool() {
 }
 
+EvictionQueue &BufferPool::GetEvictionQueueForTag(MemoryTag tag) {
+	D_ASSERT(uint8_t(tag) < queues.size());
+	return *queues[uint8_t(tag)];
+}
+
+bool EvictionQueue::AddToEvictionQueue(BufferEvictionNode &&node) {
+	auto ts = node.timestamp;
+	q.enqueue(std::move(node));
+
+	if (ts != 1) {
+		// we add a newer version, i.e., we kill exactly one previous version
+		IncrementDeadNodes();
+	}
+
+	if (++evict_queue_insertions % INSERT_INTERVAL == 0) {
+		return true;
+	}
+	return false;
+}
+
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	// The block handle is locked during this operation (Unpin),
@@ -53,17 +138,29 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 	auto ts = ++handle->eviction_timestamp;
 
 	BufferEvictionNode evict_node(weak_ptr<BlockHandle>(handle), ts);
-	queue->q.enqueue(evict_node);
+	return GetEvictionQueueForTag(handle->tag).AddToEvictionQueue(std::move(evict_node));
+}
 
-	if (ts != 1) {
-		// we add a newer version, i.e., we kill exactly one previous version
-		IncrementDeadNodes();
-	}
+void BufferPool::IncrementDeadNodes(MemoryTag tag) {
+	GetEvictionQueueForTag(tag).IncrementDeadNodes();
+}
 
-	if (++evict_queue_insertions % INSERT_INTERVAL == 0) {
-		return true;
+void BufferPool::RecordPin(MemoryTag tag, bool hit) {
+	auto &queue = GetEvictionQueueForTag(tag);
+	if (hit) {
+		queue.hits++;
+	} else {
+		queue.misses++;
 	}
-	return false;
+}
+
+EvictionQueueStatistics BufferPool::GetEvictionQueueStatistics(MemoryTag tag) const {
+	auto &queue = *queues[uint8_t(tag)];
+	EvictionQueueStatistics result;
+	result.hits = queue.hits;
+	result.misses = queue.misses;
+	result.evictions = queue.evictions;
+	return result;
 }
 
 void BufferPool::IncreaseUsedMemory(MemoryTag tag, idx_t size) {
@@ -89,25 +186,37 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
-	BufferEvictionNode node;
 	TempBufferPoolReservation r(tag, *this, extra_memory);
 
+	// visit the queues in order of eviction priority, until enough memory has been freed
+	for (auto &evict_tag : EVICTION_ORDER) {
+		if (EvictBlocksInternal(GetEvictionQueueForTag(evict_tag), extra_memory, memory_limit, buffer)) {
+			return {true, std::move(r)};
+		}
+	}
+	// none of the queues could free up enough memory
+	r.Resize(0);
+	return {false, std::move(r)};
+}
+
+bool BufferPool::EvictBlocksInternal(EvictionQueue &queue, idx_t extra_memory, idx_t memory_limit,
+                                     unique_ptr<FileBuffer> *buffer) {
+	BufferEvictionNode node;
 	while (current_memory > memory_limit) {
 		// get a block to unpin from the queue
-		if (!queue->q.try_dequeue(node)) {
+		if (!queue.q.try_dequeue(node)) {
 			// we could not dequeue any eviction node, so we try one more time,
 			// but more aggressively
-			if (!TryDequeueWithLock(node)) {
+			if (!queue.TryDequeueWithLock(node)) {
 				// still no success, we return
-				r.Resize(0);
-				return {false, std::move(r)};
+				return false;
 			}
 		}
 
 		// get a reference to the underlying block pointer
 		auto handle = node.TryGetBlockHandle();
 		if (!handle) {
-			DecrementDeadNodes();
+			queue.DecrementDeadNodes();
 			continue;
 		}
 
@@ -115,29 +224,30 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 		lock_guard<mutex> lock(handle->lock);
 		if (!node.CanUnload(*handle)) {
 			// something changed in the mean-time, bail out
-			DecrementDeadNodes();
+			queue.DecrementDeadNodes();
 			continue;
 		}
 
 		// hooray, we can unload the block
+		queue.evictions++;
 		if (buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can re-use the memory directly
 			*buffer = handle->UnloadAndTakeBlock();
-			return {true, std::move(r)};
+			return true;
 		}
 
 		// release the memory and mark the block as unloaded
 		handle->Unload();
 	}
-	return {true, std::move(r)};
+	return true;
 }
 
-bool BufferPool::TryDequeueWithLock(BufferEvictionNode &node) {
+bool EvictionQueue::TryDequeueWithLock(BufferEvictionNode &node) {
 	lock_guard<mutex> lock(purge_lock);
-	return queue->q.try_dequeue(node);
+	return q.try_dequeue(node);
 }
 
-void BufferPool::PurgeIteration(const idx_t purge_size) {
+void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 	// if this purge is significantly smaller or bigger than the previous purge, then
 	// we need to resize the purge_nodes vector. Note that this barely happens, as we
 	// purge queue_insertions * PURGE_SIZE_MULTIPLIER nodes
@@ -147,7 +257,7 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 	}
 
 	// bulk purge
-	idx_t actually_dequeued = queue->q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
+	idx_t actually_dequeued = q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
 
 	// retrieve all alive nodes that have been wrongly dequeued
 	idx_t alive_nodes = 0;
@@ -155,7 +265,7 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 		auto &node = purge_nodes[i];
 		auto handle = node.TryGetBlockHandle();
 		if (handle) {
-			queue->q.enqueue(std::move(node));
+			q.enqueue(std::move(node));
 			alive_nodes++;
 		}
 	}
@@ -163,7 +273,11 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 	total_dead_nodes -= actually_dequeued - alive_nodes;
 }
 
-void BufferPool::PurgeQueue() {
+void BufferPool::PurgeQueue(MemoryTag tag) {
+	GetEvictionQueueForTag(tag).Purge();
+}
+
+void EvictionQueue::Purge() {
 
 	// only one thread purges the queue, all other threads early-out
 	if (!purge_lock.try_lock()) {
@@ -175,7 +289,7 @@ void BufferPool::PurgeQueue() {
 	idx_t purge_size = INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER;
 
 	// get an estimate of the queue size as-of now
-	idx_t approx_q_size = queue->q.size_approx();
+	idx_t approx_q_size = q.size_approx();
 
 	// early-out, if the queue is not big enough to justify purging
 	// - we want to keep the LRU characteristic alive
@@ -205,7 +319,7 @@ void BufferPool::PurgeQueue() {
 		PurgeIteration(purge_size);
 
 		// update relevant sizes and potentially early-out
-		approx_q_size = queue->q.size_approx();
+		approx_q_size = q.size_approx();
 
 		// early-out according to (2.1)
 		if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
@@ -8,6 +8,8 @@
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/compression/bitpacking.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
@@ -157,16 +159,11 @@ public:
 		}
 
 		// Don't delta encoding 1 value makes no sense
-		if (compression_buffer_idx < 2) {
+		if (compression_buffer_idx < 2 || all_invalid) {
 			return;
 		}
 
-		// TODO: handle NULLS here?
-		// Currently we cannot handle nulls because we would need an additional step of patching for this.
-		// we could for example copy the last value on a null insert. This would help a bit, but not be optimal for
-		// large deltas since theres suddenly a zero then. Ideally we would insert a value that leads to a delta within
-		// the current domain of deltas however we dont know that domain here yet
-		if (!all_valid) {
+		if (!all_valid && !FillInvalidValues()) {
 			return;
 		}
 
@@ -214,6 +211,50 @@ public:
 		                                                              minimum_delta, delta_offset);
 	}
 
+	//! The values of NULL rows are never read back, so we replace them with values that keep their deltas in the
+	//! domain of the deltas between the valid values: the previous value plus the smallest delta between two adjacent
+	//! valid values, clamped to [minimum, maximum] so the checks on the value range still hold
+	bool FillInvalidValues() {
+		bool has_delta = false;
+		T_S fill_delta = 0;
+		for (idx_t i = 1; i < compression_buffer_idx; i++) {
+			if (!compression_buffer_validity[i - 1] || !compression_buffer_validity[i]) {
+				continue;
+			}
+			T_S delta;
+			if (!TrySubtractOperator::Operation(static_cast<T_S>(compression_buffer[i]),
+			                                    static_cast<T_S>(compression_buffer[i - 1]), delta)) {
+				return false;
+			}
+			fill_delta = has_delta ? MinValue<T_S>(fill_delta, delta) : delta;
+			has_delta = true;
+		}
+
+		// leading NULLs get the first valid value
+		idx_t first_valid = 0;
+		while (!compression_buffer_validity[first_valid]) {
+			first_valid++;
+		}
+		for (idx_t i = 0; i < first_valid; i++) {
+			compression_buffer[i] = compression_buffer[first_valid];
+		}
+		for (idx_t i = first_valid + 1; i < compression_buffer_idx; i++) {
+			if (compression_buffer_validity[i]) {
+				continue;
+			}
+			T_S fill_value;
+			if (!has_delta ||
+			    !TryAddOperator::Operation(static_cast<T_S>(compression_buffer[i - 1]), fill_delta, fill_value)) {
+				compression_buffer[i] = compression_buffer[i - 1];
+				continue;
+			}
+			fill_value = MinValue<T_S>(fill_value, static_cast<T_S>(maximum));
+			fill_value = MaxValue<T_S>(fill_value, static_cast<T_S>(minimum));
+			compression_buffer[i] = static_cast<T>(fill_value);
+		}
+		return true;
+	}
+
 	template <class T_INNER>
 	void SubtractFrameOfReference(T_INNER *buffer, T_INNER frame_of_reference) {
 		static_assert(IsIntegral<T_INNER>::value, "Integral type required.");
@@ -815,8 +856,6 @@ void BitpackingScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t
 		D_ASSERT(scan_state.current_group.mode == BitpackingMode::FOR ||
 		         scan_state.current_group.mode == BitpackingMode::DELTA_FOR);
 
-		idx_t to_scan = MinValue<idx_t>(scan_count - scanned, BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE -
-		                                                          offset_in_compression_group);
 		// Calculate start of compression algorithm group
 		data_ptr_t current_position_ptr =
 		    scan_state.current_group_ptr + scan_state.current_group_offset * scan_state.current_width / 8;
@@ -825,11 +864,19 @@ void BitpackingScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t
 
 		T *current_result_ptr = result_data + result_offset + scanned;
 
-		if (to_scan == BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE && offset_in_compression_group == 0) {
-			// Decompress directly into result vector
-			BitpackingPrimitives::UnPackBlock<T>(data_ptr_cast(current_result_ptr), decompression_group_start_pointer,
-			                                     scan_state.current_width, skip_sign_extend);
+		idx_t to_scan;
+		if (offset_in_compression_group == 0 &&
+		    scan_count - scanned >= BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE) {
+			// Decompress all complete compression algorithm groups of this metadata group directly into the result
+			// vector, so the frame of reference and the deltas are applied in one pass over up to a full vector
+			to_scan = MinValue<idx_t>(scan_count - scanned,
+			                          BITPACKING_METADATA_GROUP_SIZE - scan_state.current_group_offset);
+			to_scan -= to_scan % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+			BitpackingPrimitives::UnPackBuffer<T>(data_ptr_cast(current_result_ptr), decompression_group_start_pointer,
+			                                      to_scan, scan_state.current_width, skip_sign_extend);
 		} else {
+			to_scan = MinValue<idx_t>(scan_count - scanned, BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE -
+			                                                    offset_in_compression_group);
 			// Decompress compression algorithm to buffer
 			BitpackingPrimitives::UnPackBlock<T>(data_ptr_cast(scan_state.decompression_buffer),
 			                                     decompression_group_start_pointer, scan_state.current_width,
@@ -917,6 +964,103 @@ void BitpackingFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t r
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+//! Computes the range of the values in the current group from its metadata, without unpacking it
+//! Checks a filter against the range of a group; NULL values are removed by the caller afterwards
+static FilterPropagateResult CheckGroupFilter(const BaseStatistics &stats, const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		return NumericStats::CheckZonemap(stats, constant_filter.comparison_type, constant_filter.constant);
+	}
+	case TableFilterType::IS_NOT_NULL:
+		return FilterPropagateResult::FILTER_TRUE_OR_NULL;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		auto result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		for (auto &child_filter : conjunction.child_filters) {
+			auto child_result = CheckGroupFilter(stats, *child_filter);
+			if (child_result == FilterPropagateResult::FILTER_ALWAYS_FALSE ||
+			    child_result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
+				return child_result;
+			}
+			if (child_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+				result = child_result;
+			}
+		}
+		return result;
+	}
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+template <class T>
+static bool GetGroupRange(BitpackingScanState<T> &scan_state, idx_t scan_count, T &min, T &max) {
+	switch (scan_state.current_group.mode) {
+	case BitpackingMode::CONSTANT:
+		min = scan_state.current_constant;
+		max = scan_state.current_constant;
+		return true;
+	case BitpackingMode::CONSTANT_DELTA: {
+		auto first = static_cast<T>(scan_state.current_group_offset) * scan_state.current_constant +
+		             scan_state.current_frame_of_reference;
+		auto last = static_cast<T>(scan_state.current_group_offset + scan_count - 1) * scan_state.current_constant +
+		            scan_state.current_frame_of_reference;
+		min = MinValue(first, last);
+		max = MaxValue(first, last);
+		return true;
+	}
+	case BitpackingMode::FOR: {
+		if (scan_state.current_width >= sizeof(T) * 8) {
+			return false;
+		}
+		min = scan_state.current_frame_of_reference;
+		auto max_offset = static_cast<T>((uint64_t(1) << scan_state.current_width) - 1);
+		return TryAddOperator::Operation(min, max_offset, max);
+	}
+	default:
+		// the deltas have to be decoded to know the range of the values
+		return false;
+	}
+}
+
+template <class T>
+bool BitpackingFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                      SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<BitpackingScanState<T>>();
+	if (scan_state.current_group_offset == BITPACKING_METADATA_GROUP_SIZE) {
+		scan_state.LoadNextGroup();
+	}
+	if (scan_state.current_group_offset + scan_count > BITPACKING_METADATA_GROUP_SIZE) {
+		return false;
+	}
+	// check the filter against the range of the group
+	T min, max;
+	if (!GetGroupRange(scan_state, scan_count, min, max)) {
+		return false;
+	}
+	auto stats = NumericStats::CreateEmpty(segment.type);
+	NumericStats::Update<T>(stats, min);
+	NumericStats::Update<T>(stats, max);
+	switch (CheckGroupFilter(stats, filter)) {
+	case FilterPropagateResult::FILTER_ALWAYS_FALSE:
+	case FilterPropagateResult::FILTER_FALSE_OR_NULL:
+		// none of the values pass: no need to unpack them
+		scan_state.current_group_offset += scan_count;
+		approved_tuple_count = 0;
+		return true;
+	case FilterPropagateResult::FILTER_ALWAYS_TRUE:
+	case FilterPropagateResult::FILTER_TRUE_OR_NULL:
+		BitpackingScanPartial<T>(segment, state, scan_count, result, 0);
+		return true;
+	default:
+		return false;
+	}
+}
+
 template <class T>
 void BitpackingSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
 	auto &scan_state = static_cast<BitpackingScanState<T> &>(*state.scan_state);
@@ -928,11 +1072,16 @@ void BitpackingSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_c
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetBitpackingFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_BITPACKING, data_type, BitpackingInitAnalyze<T>,
-	                           BitpackingAnalyze<T>, BitpackingFinalAnalyze<T>,
-	                           BitpackingInitCompression<T, WRITE_STATISTICS>, BitpackingCompress<T, WRITE_STATISTICS>,
-	                           BitpackingFinalizeCompress<T, WRITE_STATISTICS>, BitpackingInitScan<T>,
-	                           BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
+	auto result = CompressionFunction(
+	    CompressionType::COMPRESSION_BITPACKING, data_type, BitpackingInitAnalyze<T>, BitpackingAnalyze<T>,
+	    BitpackingFinalAnalyze<T>, BitpackingInitCompression<T, WRITE_STATISTICS>,
+	    BitpackingCompress<T, WRITE_STATISTICS>, BitpackingFinalizeCompress<T, WRITE_STATISTICS>,
+	    BitpackingInitScan<T>, BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
+	// the range of a group is only derived for integers that fit in 64 bits, and lists are never filtered on
+	if (WRITE_STATISTICS && data_type != PhysicalType::BOOL && sizeof(T) <= sizeof(uint64_t)) {
+		result.filter = BitpackingFilter<T>;
+	}
+	return result;
 }
 
 CompressionFunction BitpackingFun::GetFunction(PhysicalType type) {
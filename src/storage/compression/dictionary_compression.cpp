@@ -104,6 +104,8 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static bool StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                         SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -428,10 +430,15 @@ void DictionaryCompressionStorage::FinalizeCompress(CompressionState &state_p) {
 //===--------------------------------------------------------------------===//
 struct CompressedStringScanState : public StringScanState {
 	BufferHandle handle;
-	buffer_ptr<Vector> dictionary;
+	//! The strings of the dictionary, shared by the dictionary vectors emitted by the scan
+	buffer_ptr<VectorChildBuffer> dictionary;
+	idx_t dictionary_size = 0;
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	//! The filter that was evaluated on the dictionary, and whether each of the strings passes it
+	optional_ptr<const TableFilter> filter;
+	unsafe_unique_array<bool> filter_result;
 };
 
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
@@ -450,8 +457,9 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 
 	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
 
-	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
-	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
+	state->dictionary = DictionaryVector::CreateSharedDictionary(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
+	auto dict_child_data = FlatVector::GetData<string_t>(state->dictionary->data);
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
 		// NOTE: the passing of dict_child_vector, will not be used, its for big strings
@@ -531,7 +539,7 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 
 		BitpackingPrimitives::UnPackBuffer<sel_t>(dst, src, scan_count, scan_state.current_width);
 
-		result.Slice(*(scan_state.dictionary), *scan_state.sel_vec, scan_count);
+		result.Dictionary(scan_state.dictionary, *scan_state.sel_vec);
 	}
 }
 
@@ -540,6 +548,52 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+bool DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                                Vector &result, SelectionVector &sel, idx_t &approved_tuple_count,
+                                                const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	if (scan_state.filter.get() != &filter) {
+		// evaluate the filter once for every string in the dictionary of the segment
+		auto dictionary_size = scan_state.dictionary_size;
+		scan_state.filter_result = make_unsafe_uniq_array<bool>(MaxValue<idx_t>(dictionary_size, 1));
+		memset(scan_state.filter_result.get(), 0, dictionary_size * sizeof(bool));
+		for (idx_t offset = 0; offset < dictionary_size; offset += STANDARD_VECTOR_SIZE) {
+			auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, dictionary_size - offset);
+			Vector strings(scan_state.dictionary->data, offset, offset + count);
+			UnifiedVectorFormat vdata;
+			strings.ToUnifiedFormat(count, vdata);
+
+			SelectionVector strings_sel;
+			strings_sel.Initialize(nullptr);
+			idx_t match_count = count;
+			ColumnSegment::FilterSelection(strings_sel, strings, vdata, filter, count, match_count);
+			for (idx_t i = 0; i < match_count; i++) {
+				scan_state.filter_result[offset + strings_sel.get_index(i)] = true;
+			}
+		}
+		scan_state.filter = &filter;
+	}
+
+	auto start = segment.GetRelativeIndex(state.row_index);
+	StringScanPartial<true>(segment, state, scan_count, result, 0);
+
+	// the scan leaves the string numbers of the scanned rows in the selection vector of the scan state
+	auto string_numbers = scan_state.sel_vec->data() + start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		new_sel.set_index(result_count, idx);
+		result_count += scan_state.filter_result[string_numbers[idx]];
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+	return true;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -636,13 +690,15 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	auto result = CompressionFunction(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	result.filter = DictionaryCompressionStorage::StringFilter;
+	return result;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(PhysicalType type) {
@@ -372,6 +372,61 @@ void RLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, V
 	RLEScanPartialInternal<T, true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+bool RLEFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+               idx_t &approved_tuple_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<RLEScanState<T>>();
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = reinterpret_cast<T *>(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = reinterpret_cast<rle_count_t *>(data + scan_state.rle_count_offset);
+
+	// find the runs that the vector consists of
+	auto entry_pos = scan_state.entry_pos;
+	idx_t run_count = 0;
+	for (idx_t rows = 0; rows < scan_state.position_in_entry + scan_count; run_count++) {
+		rows += index_pointer[entry_pos + run_count];
+	}
+	D_ASSERT(run_count <= STANDARD_VECTOR_SIZE);
+
+	// evaluate the filter once for every run
+	Vector run_values(segment.type, data_ptr_cast(data_pointer + entry_pos));
+	UnifiedVectorFormat vdata;
+	run_values.ToUnifiedFormat(run_count, vdata);
+	SelectionVector run_sel;
+	run_sel.Initialize(nullptr);
+	idx_t run_match_count = run_count;
+	ColumnSegment::FilterSelection(run_sel, run_values, vdata, filter, run_count, run_match_count);
+	bool run_matches[STANDARD_VECTOR_SIZE];
+	memset(run_matches, 0, run_count * sizeof(bool));
+	for (idx_t i = 0; i < run_match_count; i++) {
+		run_matches[run_sel.get_index(i)] = true;
+	}
+
+	// the rows in the selection are sorted: walk over the runs and the rows together
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	idx_t run_idx = 0;
+	idx_t run_end = index_pointer[entry_pos] - scan_state.position_in_entry;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		while (idx >= run_end) {
+			run_idx++;
+			run_end += index_pointer[entry_pos + run_idx];
+		}
+		new_sel.set_index(result_count, idx);
+		result_count += run_matches[run_idx];
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+
+	RLEScanPartialInternal<T, true>(segment, state, scan_count, result, 0);
+	return true;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -391,10 +446,15 @@ void RLEFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id,
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetRLEFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
-	                           RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
-	                           RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
-	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	auto result = CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
+	                                  RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
+	                                  RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
+	                                  RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	if (WRITE_STATISTICS) {
+		// the offsets of lists are never filtered on
+		result.filter = RLEFilter<T>;
+	}
+	return result;
 }
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
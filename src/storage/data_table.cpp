@@ -31,7 +31,7 @@ namespace duckdb {
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
     : db(db), table_io_manager(std::move(table_io_manager_p)), cardinality(0), schema(std::move(schema)),
-      table(std::move(table)) {
+      table(std::move(table)), last_commit_id(0) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context) {
@@ -31,6 +31,7 @@ void DataPointer::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty<CompressionType>(103, "compression_type", compression_type);
 	serializer.WriteProperty<BaseStatistics>(104, "statistics", statistics);
 	serializer.WritePropertyWithDefault<unique_ptr<ColumnSegmentState>>(105, "segment_state", segment_state);
+	serializer.WritePropertyWithDefault<vector<uint64_t>>(106, "bloom_filter", bloom_filter);
 }
 
 DataPointer DataPointer::Deserialize(Deserializer &deserializer) {
@@ -46,6 +47,7 @@ DataPointer DataPointer::Deserialize(Deserializer &deserializer) {
 	result.compression_type = compression_type;
 	deserializer.Set<CompressionType>(compression_type);
 	deserializer.ReadPropertyWithDefault<unique_ptr<ColumnSegmentState>>(105, "segment_state", result.segment_state);
+	deserializer.ReadPropertyWithDefault<vector<uint64_t>>(106, "bloom_filter", result.bloom_filter);
 	deserializer.Unset<CompressionType>();
 	return result;
 }
@@ -416,6 +416,29 @@ void SingleFileBlockManager::Read(Block &block) {
 	ReadAndChecksum(block, BLOCK_START + block.id * Storage::BLOCK_ALLOC_SIZE);
 }
 
+void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) {
+	D_ASSERT(start_block >= 0);
+	D_ASSERT(block_count >= 1);
+	D_ASSERT(buffer.AllocSize() >= block_count * Storage::BLOCK_ALLOC_SIZE);
+
+	// read all blocks with a single read
+	auto location = BLOCK_START + NumericCast<idx_t>(start_block) * Storage::BLOCK_ALLOC_SIZE;
+	auto internal_buffer = buffer.InternalBuffer();
+	handle->Read(internal_buffer, block_count * Storage::BLOCK_ALLOC_SIZE, location);
+
+	// verify the checksum of each of the blocks
+	for (idx_t i = 0; i < block_count; i++) {
+		auto block_ptr = internal_buffer + i * Storage::BLOCK_ALLOC_SIZE;
+		auto stored_checksum = Load<uint64_t>(block_ptr);
+		uint64_t computed_checksum = Checksum(block_ptr + Storage::BLOCK_HEADER_SIZE, Storage::BLOCK_SIZE);
+		if (stored_checksum != computed_checksum) {
+			throw IOException(
+			    "Corrupt database file: computed checksum %llu does not match stored checksum %llu in block %llu",
+			    computed_checksum, stored_checksum, start_block + NumericCast<block_id_t>(i));
+		}
+	}
+}
+
 void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 	D_ASSERT(block_id >= 0);
 	ChecksumAndWrite(buffer, BLOCK_START + block_id * Storage::BLOCK_ALLOC_SIZE);
@@ -159,6 +159,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
 			handle->readers++;
+			buffer_pool.RecordPin(handle->tag, true);
 			return handle->Load(handle);
 		}
 		required_memory = handle->memory_usage;
@@ -175,11 +176,13 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// the block is loaded, increment the reader count and return a pointer to the handle
 		handle->readers++;
 		reservation.Resize(0);
+		buffer_pool.RecordPin(handle->tag, true);
 		return handle->Load(handle);
 	}
 	// now we can actually load the current block
 	D_ASSERT(handle->readers == 0);
 	handle->readers = 1;
+	buffer_pool.RecordPin(handle->tag, false);
 	auto buf = handle->Load(handle, std::move(reusable_buffer));
 	handle->memory_charge = std::move(reservation);
 	// In the case of a variable sized block, the buffer may be smaller than a full block.
@@ -193,8 +196,94 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	return buf;
 }
 
-void StandardBufferManager::PurgeQueue() {
-	buffer_pool.PurgeQueue();
+void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
+	// prefetched blocks are unpinned right away, only read ahead as much as comfortably fits in the free memory
+	auto used_memory = GetUsedMemory();
+	auto max_memory = GetMaxMemory();
+	auto prefetch_budget = used_memory < max_memory ? (max_memory - used_memory) / 4 : 0;
+
+	// figure out which persistent blocks still have to be loaded, sorted by their position on disk
+	map<block_id_t, idx_t> to_be_loaded;
+	for (idx_t block_idx = 0; block_idx < handles.size(); block_idx++) {
+		auto &handle = handles[block_idx];
+		if (handle->BlockId() >= MAXIMUM_BLOCK) {
+			continue;
+		}
+		lock_guard<mutex> lock(handle->lock);
+		if (handle->state == BlockState::BLOCK_LOADED) {
+			continue;
+		}
+		if ((to_be_loaded.size() + 1) * Storage::BLOCK_ALLOC_SIZE > prefetch_budget) {
+			break;
+		}
+		to_be_loaded.insert(make_pair(handle->BlockId(), block_idx));
+	}
+	if (to_be_loaded.empty()) {
+		return;
+	}
+
+	// coalesce runs of adjacent blocks into a single read
+	block_id_t first_block = -1;
+	block_id_t previous_block = -1;
+	for (auto &entry : to_be_loaded) {
+		if (previous_block < 0) {
+			first_block = entry.first;
+		} else if (previous_block + 1 != entry.first) {
+			BatchRead(handles, to_be_loaded, first_block, previous_block);
+			first_block = entry.first;
+		}
+		previous_block = entry.first;
+	}
+	BatchRead(handles, to_be_loaded, first_block, previous_block);
+}
+
+void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+                                      block_id_t first_block, block_id_t last_block) {
+	auto block_count = NumericCast<idx_t>(last_block - first_block + 1);
+	if (block_count == 1) {
+		// a single block does not benefit from being read ahead - it is read when it is pinned
+		return;
+	}
+	auto &block_manager = handles[load_map.find(first_block)->second]->block_manager;
+
+	// read the blocks into an intermediate buffer
+	auto intermediate_buffer = Allocate(MemoryTag::BASE_TABLE, block_count * Storage::BLOCK_ALLOC_SIZE);
+	block_manager.ReadBlocks(intermediate_buffer.GetFileBuffer(), first_block, block_count);
+
+	// now load the individual blocks from the intermediate buffer
+	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+		auto entry = load_map.find(first_block + NumericCast<block_id_t>(block_idx));
+		D_ASSERT(entry != load_map.end());
+		auto &handle = handles[entry->second];
+
+		unique_ptr<FileBuffer> reusable_buffer;
+		auto reservation =
+		    EvictBlocksOrThrow(handle->tag, handle->memory_usage, &reusable_buffer, "failed to prefetch block of size %s%s",
+		                       StringUtil::BytesToHumanReadableString(handle->memory_usage));
+		// the handle is released (and the block added to the eviction queue) right away
+		// the block is pinned again when the scan reaches it
+		BufferHandle buf;
+		{
+			lock_guard<mutex> lock(handle->lock);
+			if (handle->state == BlockState::BLOCK_LOADED) {
+				// another thread loaded the block in the meantime
+				reservation.Resize(0);
+				continue;
+			}
+			D_ASSERT(handle->readers == 0);
+			handle->readers = 1;
+			buffer_pool.RecordPin(handle->tag, false);
+			buf = BlockHandle::LoadFromBuffer(handle,
+			                                  intermediate_buffer.Ptr() - Storage::BLOCK_HEADER_SIZE +
+			                                      block_idx * Storage::BLOCK_ALLOC_SIZE,
+			                                  std::move(reusable_buffer));
+			handle->memory_charge = std::move(reservation);
+		}
+	}
+}
+
+void StandardBufferManager::PurgeQueue(MemoryTag tag) {
+	buffer_pool.PurgeQueue(tag);
 }
 
 void StandardBufferManager::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
@@ -228,7 +317,7 @@ void StandardBufferManager::Unpin(shared_ptr<BlockHandle> &handle) {
 
 	// We do not have to keep the handle locked while purging.
 	if (purge) {
-		PurgeQueue();
+		PurgeQueue(handle->tag);
 	}
 }
 
@@ -243,6 +332,10 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage_per_tag[k].load();
 		info.evicted_data = evicted_data_per_tag[k].load();
+		auto stats = buffer_pool.GetEvictionQueueStatistics(info.tag);
+		info.hits = stats.hits;
+		info.misses = stats.misses;
+		info.evictions = stats.evictions;
 		result.push_back(info);
 	}
 	return result;
@@ -368,6 +461,9 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		info.path = name;
 		auto handle = fs.OpenFile(name, FileFlags::FILE_FLAGS_READ);
 		info.size = fs.GetFileSize(*handle);
+		info.block_size = info.size;
+		info.block_count = 1;
+		info.uncompressed_size = info.size;
 		handle.reset();
 		result.push_back(info);
 	});
@@ -1,6 +1,8 @@
 #include "duckdb/storage/statistics/segment_statistics.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 
 namespace duckdb {
 
@@ -10,4 +12,43 @@ SegmentStatistics::SegmentStatistics(LogicalType type) : statistics(BaseStatisti
 SegmentStatistics::SegmentStatistics(BaseStatistics stats) : statistics(std::move(stats)) {
 }
 
+FilterPropagateResult SegmentStatistics::CheckBloomFilter(TableFilter &filter) const {
+	if (!bloom_filter) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL || constant_filter.constant.IsNull()) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		if (!bloom_filter->LookupHash(constant_filter.constant.Hash())) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		// an IN list: none of the values can be in the segment
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (CheckBloomFilter(*child_filter) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (CheckBloomFilter(*child_filter) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			}
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
 } // namespace duckdb
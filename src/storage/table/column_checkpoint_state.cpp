@@ -112,6 +112,17 @@ void PartialBlockForCheckpoint::Clear() {
 	segments.clear();
 }
 
+unique_ptr<BloomFilter> ColumnCheckpointState::CreateBloomFilter(const hash_t *hashes, idx_t count) {
+	// size the filter for the amount of distinct values, so low-cardinality segments get small filters
+	vector<hash_t> distinct_hashes(hashes, hashes + count);
+	std::sort(distinct_hashes.begin(), distinct_hashes.end());
+	auto distinct_count = NumericCast<idx_t>(std::unique(distinct_hashes.begin(), distinct_hashes.end()) -
+	                                         distinct_hashes.begin());
+	auto result = make_uniq<BloomFilter>(distinct_count * BLOOM_FILTER_BITS_PER_KEY / BloomFilter::BITS_PER_KEY);
+	result->InsertHashes(distinct_hashes.data(), distinct_count);
+	return result;
+}
+
 void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_t segment_size) {
 	D_ASSERT(segment_size <= Storage::BLOCK_SIZE);
 	auto tuple_count = segment->count.load();
@@ -186,6 +197,13 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 	if (segment->function.get().serialize_state) {
 		data_pointer.segment_state = segment->function.get().serialize_state(*segment);
 	}
+	if (build_bloom_filters) {
+		// all values of the row group have been hashed before they were compressed
+		auto row_offset = data_pointer.row_start - row_group.start;
+		D_ASSERT(row_offset + tuple_count <= value_hashes.size());
+		segment->stats.bloom_filter = CreateBloomFilter(value_hashes.data() + row_offset, tuple_count);
+		data_pointer.bloom_filter = segment->stats.bloom_filter->blocks;
+	}
 
 	// append the segment to the new segment tree
 	new_tree.AppendSegment(std::move(segment));
@@ -2,6 +2,7 @@
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -61,6 +62,27 @@ idx_t ColumnData::GetMaxEntry() {
 	return count;
 }
 
+void ColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows) {
+	auto current_segment = scan_state.current;
+	if (!current_segment) {
+		return;
+	}
+	idx_t row_index = scan_state.row_index;
+	while (true) {
+		current_segment->InitializePrefetch(prefetch_state);
+		auto segment_end = current_segment->start + current_segment->count;
+		if (row_index + rows <= segment_end) {
+			break;
+		}
+		rows -= segment_end - row_index;
+		row_index = segment_end;
+		current_segment = data.GetNextSegment(current_segment);
+		if (!current_segment) {
+			break;
+		}
+	}
+}
+
 void ColumnData::InitializeScan(ColumnScanState &state) {
 	state.current = data.GetRootSegment();
 	state.segment_tree = &data;
@@ -208,6 +230,80 @@ void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnS
 	ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, count);
 }
 
+//! Whether the filter never passes NULLs, and only needs the values of the rows to be evaluated
+static bool FilterRejectsNulls(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IS_NOT_NULL:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_and = filter.Cast<ConjunctionAndFilter>();
+		bool rejects_nulls = false;
+		for (auto &child_filter : conjunction_and.child_filters) {
+			if (child_filter->filter_type == TableFilterType::IS_NULL) {
+				continue;
+			}
+			if (!FilterRejectsNulls(*child_filter)) {
+				return false;
+			}
+			rejects_nulls = true;
+		}
+		return rejects_nulls;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_or = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction_or.child_filters) {
+			if (!FilterRejectsNulls(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ColumnData::FilterCompressed(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
+                                  idx_t &approved_tuple_count, const TableFilter &filter) {
+	if (!state.current || !state.current->function.get().filter || !FilterRejectsNulls(filter)) {
+		return false;
+	}
+	if (state.scan_options && state.scan_options->force_fetch_row) {
+		return false;
+	}
+	{
+		lock_guard<mutex> update_guard(update_lock);
+		if (updates) {
+			// the updated values are not in the compressed data
+			return false;
+		}
+	}
+	// the vector has to be contained in the current segment
+	auto &segment = *state.current;
+	idx_t current_row = vector_index * STANDARD_VECTOR_SIZE;
+	auto vector_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - current_row);
+	if (state.row_index < segment.start || state.row_index + vector_count > segment.start + segment.count) {
+		return false;
+	}
+
+	state.previous_states.clear();
+	if (!state.initialized) {
+		segment.InitializeScan(state);
+		state.internal_index = segment.start;
+		state.initialized = true;
+	}
+	if (state.internal_index < state.row_index) {
+		segment.Skip(state);
+	}
+	if (!segment.Filter(state, vector_count, result, sel, approved_tuple_count, filter)) {
+		return false;
+	}
+	state.row_index += vector_count;
+	state.internal_index = state.row_index;
+	return true;
+}
+
 void ColumnData::FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                             SelectionVector &sel, idx_t count) {
 	Scan(transaction, vector_index, state, result);
@@ -246,7 +342,19 @@ bool ColumnData::CheckZonemap(TableFilter &filter) {
 	    propagate_result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
 		return false;
 	}
-	return true;
+	if (updates) {
+		// updated values are not in the Bloom filters of the segments
+		return true;
+	}
+	// check if the Bloom filters of all segments rule out the filter
+	bool has_segments = false;
+	for (auto &segment : data.Segments()) {
+		if (segment.stats.CheckBloomFilter(filter) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return true;
+		}
+		has_segments = true;
+	}
+	return !has_segments;
 }
 
 unique_ptr<BaseStatistics> ColumnData::GetStatistics() {
@@ -487,6 +595,9 @@ void ColumnData::DeserializeColumn(Deserializer &deserializer, BaseStatistics &t
 		    GetDatabase(), block_manager, data_pointer.block_pointer.block_id, data_pointer.block_pointer.offset, type,
 		    data_pointer.row_start, data_pointer.tuple_count, data_pointer.compression_type,
 		    std::move(data_pointer.statistics), std::move(data_pointer.segment_state));
+		if (!data_pointer.bloom_filter.empty()) {
+			segment->stats.bloom_filter = make_uniq<BloomFilter>(std::move(data_pointer.bloom_filter));
+		}
 
 		data.AppendSegment(std::move(segment));
 	}
@@ -4,6 +4,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/parser/column_definition.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 
 namespace duckdb {
 
@@ -197,9 +198,21 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	auto best_function = compression_functions[compression_idx];
 	auto compress_state = best_function->init_compression(*this, std::move(analyze_state));
 
-	ScanSegments(
-	    [&](Vector &scan_vector, idx_t count) { best_function->compress(*compress_state, scan_vector, count); });
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	state.build_bloom_filters = config.options.checkpoint_bloom_filters && !is_validity && !GetType().IsNested();
+	Vector hash_vector(LogicalType::HASH);
+	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		if (state.build_bloom_filters) {
+			// hash the values before compressing them, so they are available when the segment is flushed
+			VectorOperations::Hash(scan_vector, hash_vector, count);
+			hash_vector.Flatten(count);
+			auto hashes = FlatVector::GetData<hash_t>(hash_vector);
+			state.value_hashes.insert(state.value_hashes.end(), hashes, hashes + count);
+		}
+		best_function->compress(*compress_state, scan_vector, count);
+	});
 	best_function->compress_finalize(*compress_state);
+	state.value_hashes.clear();
 
 	nodes.clear();
 }
@@ -239,6 +252,9 @@ void ColumnDataCheckpointer::WritePersistentSegments() {
 		if (segment->function.get().serialize_state) {
 			pointer.segment_state = segment->function.get().serialize_state(*segment);
 		}
+		if (segment->stats.bloom_filter) {
+			pointer.bloom_filter = segment->stats.bloom_filter->blocks;
+		}
 
 		// merge the persistent stats into the global column stats
 		state.global_stats->Merge(segment->stats.statistics);
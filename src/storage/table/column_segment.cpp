@@ -5,8 +5,10 @@
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -99,6 +101,18 @@ ColumnSegment::~ColumnSegment() {
 //===--------------------------------------------------------------------===//
 // Scan
 //===--------------------------------------------------------------------===//
+void PrefetchState::AddBlock(shared_ptr<BlockHandle> block) {
+	blocks.push_back(std::move(block));
+}
+
+void ColumnSegment::InitializePrefetch(PrefetchState &prefetch_state) {
+	if (segment_type != ColumnSegmentType::PERSISTENT || !block) {
+		// transient and constant segments are not read from disk
+		return;
+	}
+	prefetch_state.AddBlock(block);
+}
+
 void ColumnSegment::InitializeScan(ColumnScanState &state) {
 	state.scan_state = function.get().init_scan(*this);
 }
@@ -128,6 +142,14 @@ void ColumnSegment::ScanPartial(ColumnScanState &state, idx_t scan_count, Vector
 	function.get().scan_partial(*this, state, scan_count, result, result_offset);
 }
 
+bool ColumnSegment::Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+                           idx_t &approved_tuple_count, const TableFilter &filter) {
+	if (!function.get().filter) {
+		return false;
+	}
+	return function.get().filter(*this, state, scan_count, result, sel, approved_tuple_count, filter);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -364,31 +386,40 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_OR: {
 		// similar to the CONJUNCTION_AND, but we need to take care of the SelectionVectors (OR all of them)
+		// we mark the tuples that pass any of the child filters, and then emit them in their original order
+		D_ASSERT(scan_count <= STANDARD_VECTOR_SIZE);
+		bool passed[STANDARD_VECTOR_SIZE];
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			passed[sel.get_index(i)] = false;
+		}
 		idx_t count_total = 0;
-		SelectionVector result_sel(approved_tuple_count);
 		auto &conjunction_or = filter.Cast<ConjunctionOrFilter>();
 		for (auto &child_filter : conjunction_or.child_filters) {
 			SelectionVector temp_sel;
 			temp_sel.Initialize(sel);
 			idx_t temp_tuple_count = approved_tuple_count;
 			idx_t temp_count = FilterSelection(temp_sel, vector, vdata, *child_filter, scan_count, temp_tuple_count);
-			// tuples passed, move them into the actual result vector
 			for (idx_t i = 0; i < temp_count; i++) {
 				auto new_idx = temp_sel.get_index(i);
-				bool is_new_idx = true;
-				for (idx_t res_idx = 0; res_idx < count_total; res_idx++) {
-					if (result_sel.get_index(res_idx) == new_idx) {
-						is_new_idx = false;
-						break;
-					}
-				}
-				if (is_new_idx) {
-					result_sel.set_index(count_total++, new_idx);
-				}
+				count_total += !passed[new_idx];
+				passed[new_idx] = true;
+			}
+			if (count_total == approved_tuple_count) {
+				// all tuples have passed already: no need to check the remaining child filters
+				break;
 			}
 		}
+		SelectionVector result_sel(approved_tuple_count);
+		idx_t result_count = 0;
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			if (passed[idx]) {
+				result_sel.set_index(result_count++, idx);
+			}
+		}
+		D_ASSERT(result_count == count_total);
 		sel.Initialize(result_sel);
-		approved_tuple_count = count_total;
+		approved_tuple_count = result_count;
 		return approved_tuple_count;
 	}
 	case TableFilterType::CONJUNCTION_AND: {
@@ -500,6 +531,22 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return FilterSelection(sel, *child_vec, child_data, *struct_filter.child_filter, scan_count,
 		                       approved_tuple_count);
 	}
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		return bloom_filter.Filter(vector, vdata, sel, approved_tuple_count, scan_count);
+	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			return approved_tuple_count;
+		}
+		auto constant_filter = dynamic_filter.filter_data->GetFilter();
+		if (!constant_filter) {
+			// the filter has not been set yet: everything passes
+			return approved_tuple_count;
+		}
+		return FilterSelection(sel, vector, vdata, *constant_filter, scan_count, approved_tuple_count);
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
@@ -29,6 +29,12 @@ bool ListColumnData::CheckZonemap(ColumnScanState &state, TableFilter &filter) {
 	return false;
 }
 
+void ListColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows) {
+	// the amount of child rows is only known while scanning, only the offsets and validity are read ahead
+	ColumnData::InitializePrefetch(prefetch_state, scan_state, rows);
+	validity.InitializePrefetch(prefetch_state, scan_state.child_states[0], rows);
+}
+
 void ListColumnData::InitializeScan(ColumnScanState &state) {
 	ColumnData::InitializeScan(state);
 
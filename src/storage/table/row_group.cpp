@@ -200,6 +200,7 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	PrefetchScan(state);
 	return true;
 }
 
@@ -229,9 +230,34 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	PrefetchScan(state);
 	return true;
 }
 
+void RowGroup::PrefetchScan(CollectionScanState &state) {
+	if (state.GetFilters() || state.GetOptions().force_fetch_row) {
+		// segments can be skipped based on their zonemaps - only read blocks when they are actually scanned
+		return;
+	}
+	auto scan_start = MinValue<idx_t>(state.vector_index * STANDARD_VECTOR_SIZE, state.max_row_group_row);
+	auto rows = state.max_row_group_row - scan_start;
+	if (rows == 0) {
+		return;
+	}
+	PrefetchState prefetch_state;
+	auto &column_ids = state.GetColumnIds();
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		const auto &column = column_ids[i];
+		if (column != COLUMN_IDENTIFIER_ROW_ID) {
+			GetColumn(column).InitializePrefetch(prefetch_state, state.column_scans[i], rows);
+		}
+	}
+	if (prefetch_state.blocks.empty()) {
+		return;
+	}
+	GetBlockManager().buffer_manager.Prefetch(prefetch_state.blocks);
+}
+
 unique_ptr<RowGroup> RowGroup::AlterType(RowGroupCollection &new_collection, const LogicalType &target_type,
                                          idx_t changed_idx, ExpressionExecutor &executor,
                                          CollectionScanState &scan_state, DataChunk &scan_chunk) {
@@ -396,6 +422,8 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::DYNAMIC_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -29,7 +29,11 @@ bool StandardColumnData::CheckZonemap(ColumnScanState &state, TableFilter &filte
 		state.segment_checked = true;
 		auto prune_result = filter.CheckStatistics(state.current->stats.statistics);
 		if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-			return true;
+			if (updates) {
+				// updated values are not in the Bloom filter of the segment
+				return true;
+			}
+			return state.current->stats.CheckBloomFilter(filter) != FilterPropagateResult::FILTER_ALWAYS_FALSE;
 		}
 		if (updates) {
 			auto update_stats = updates->GetStatistics();
@@ -43,6 +47,11 @@ bool StandardColumnData::CheckZonemap(ColumnScanState &state, TableFilter &filte
 	}
 }
 
+void StandardColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows) {
+	ColumnData::InitializePrefetch(prefetch_state, scan_state, rows);
+	validity.InitializePrefetch(prefetch_state, scan_state.child_states[0], rows);
+}
+
 void StandardColumnData::InitializeScan(ColumnScanState &state) {
 	ColumnData::InitializeScan(state);
 
@@ -81,6 +90,35 @@ idx_t StandardColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_
 	return scan_count;
 }
 
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                Vector &result, SelectionVector &sel, idx_t &count, const TableFilter &filter) {
+	D_ASSERT(state.row_index == state.child_states[0].row_index);
+	if (!FilterCompressed(vector_index, state, result, sel, count, filter)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, count, filter);
+		return;
+	}
+	auto scan_count = validity.Scan(transaction, vector_index, state.child_states[0], result);
+	if (count == 0) {
+		return;
+	}
+	// the filter was evaluated on the values of the NULLs as well: remove them
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(scan_count, vdata);
+	if (vdata.validity.AllValid()) {
+		return;
+	}
+	SelectionVector valid_sel(count);
+	idx_t valid_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		if (vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			valid_sel.set_index(valid_count++, idx);
+		}
+	}
+	sel.Initialize(valid_sel);
+	count = valid_count;
+}
+
 void StandardColumnData::InitializeAppend(ColumnAppendState &state) {
 	ColumnData::InitializeAppend(state);
 
@@ -1,7 +1,10 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
+#include "lz4.hpp"
+
 namespace duckdb {
 
 //===--------------------------------------------------------------------===//
@@ -54,6 +57,10 @@ bool BlockIndexManager::HasFreeBlocks() {
 	return !free_indexes.empty();
 }
 
+idx_t BlockIndexManager::GetBlockCount() {
+	return indexes_in_use.size();
+}
+
 idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 	if (free_indexes.empty()) {
 		return max_index++;
@@ -68,10 +75,17 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string GetTemporaryFileName(idx_t index, TemporaryBufferSize size) {
+	if (size == TemporaryBufferSize::DEFAULT) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	return "duckdb_temp_storage_" + to_string(idx_t(size) / 1024) + "K-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")) {
+                                         idx_t index, TemporaryBufferSize size)
+    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), size(size), file_index(index),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, GetTemporaryFileName(index, size))) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -90,16 +104,42 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	if (size == TemporaryBufferSize::DEFAULT) {
+		D_ASSERT(!compressed_buffer.IsSet());
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+	} else {
+		// the slot is written as a whole, so that reading the last slot of the file never reads past the end
+		D_ASSERT(compressed_buffer.GetSize() >= idx_t(size));
+		handle->Write(compressed_buffer.get(), idx_t(size), GetPositionInFile(index.block_index));
+	}
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle,
-	                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
-	                                                          std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (size == TemporaryBufferSize::DEFAULT) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(
+		    buffer_manager, *handle, GetPositionInFile(block_index), Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	}
+	// read the compressed slot: the compressed size is followed by the compressed data
+	auto compressed_buffer = Allocator::Get(db).Allocate(idx_t(size));
+	handle->Read(compressed_buffer.get(), compressed_buffer.GetSize(), GetPositionInFile(block_index));
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	if (compressed_size > idx_t(size) - sizeof(idx_t)) {
+		throw IOException("Corrupt temporary block %llu in file \"%s\"", block_index, path);
+	}
+
+	auto buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(
+	    const_char_ptr_cast(compressed_buffer.get() + sizeof(idx_t)), char_ptr_cast(buffer->buffer),
+	    NumericCast<int>(compressed_size), NumericCast<int>(buffer->size));
+	if (decompressed_size < 0 || idx_t(decompressed_size) != buffer->size) {
+		throw IOException("Failed to decompress temporary block %llu in file \"%s\"", block_index, path);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -127,6 +167,9 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	info.block_size = idx_t(size);
+	info.block_count = index_manager.GetBlockCount();
+	info.uncompressed_size = info.block_count * Storage::BLOCK_ALLOC_SIZE;
 	return info;
 }
 
@@ -153,7 +196,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * Storage::BLOCK_ALLOC_SIZE;
+	return index * idx_t(size);
 }
 
 //===--------------------------------------------------------------------===//
@@ -231,16 +274,53 @@ TemporaryFileManager::TemporaryFileManager(DatabaseInstance &db, const string &t
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+TemporaryBufferSize TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer) {
+	static_assert(idx_t(TemporaryBufferSize::DEFAULT) == Storage::BLOCK_ALLOC_SIZE,
+	              "the default temporary buffer size must be the block allocation size");
+	auto &config = DBConfig::GetConfig(db);
+	if (config.options.temporary_compression == TemporaryCompressionType::UNCOMPRESSED) {
+		return TemporaryBufferSize::DEFAULT;
+	}
+	D_ASSERT(config.options.temporary_compression == TemporaryCompressionType::LZ4);
+
+	// the compressed block is stored as its compressed size, followed by the compressed data
+	const auto max_compressed_size = duckdb_lz4::LZ4_compressBound(NumericCast<int>(buffer.size));
+	compressed_buffer = Allocator::Get(db).Allocate(sizeof(idx_t) + NumericCast<idx_t>(max_compressed_size));
+	auto compressed_size = duckdb_lz4::LZ4_compress_default(
+	    const_char_ptr_cast(buffer.buffer), char_ptr_cast(compressed_buffer.get() + sizeof(idx_t)),
+	    NumericCast<int>(buffer.size), max_compressed_size);
+	const auto total_size = sizeof(idx_t) + NumericCast<idx_t>(MaxValue<int>(compressed_size, 0));
+	const auto slot_size = AlignValue<idx_t, idx_t(TemporaryBufferSize::S32K)>(total_size);
+	if (compressed_size <= 0 || slot_size >= idx_t(TemporaryBufferSize::DEFAULT)) {
+		// the block could not be compressed (enough): write it uncompressed
+		compressed_buffer.Reset();
+		return TemporaryBufferSize::DEFAULT;
+	}
+	Store<idx_t>(NumericCast<idx_t>(compressed_size), compressed_buffer.get());
+	// zero-initialize the remainder of the slot
+	memset(compressed_buffer.get() + total_size, 0, slot_size - total_size);
+	return TemporaryBufferSize(slot_size);
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
+	// compress the buffer before grabbing the lock
+	AllocatedData compressed_buffer;
+	auto size = CompressBuffer(buffer, compressed_buffer);
+
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the same slot size
+		idx_t file_count = 0;
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSize() != size) {
+				continue;
+			}
+			file_count++;
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -250,7 +330,7 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index);
+			auto new_file = make_uniq<TemporaryFileHandle>(file_count, db, temp_directory, new_file_index, size);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -261,7 +341,7 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
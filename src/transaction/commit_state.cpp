@@ -301,6 +301,7 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 		}
 		// mark the tuples as committed
 		info->table->CommitAppend(commit_id, info->start_row, info->count);
+		info->table->info->last_commit_id = commit_id;
 		break;
 	}
 	case UndoFlags::DELETE_TUPLE: {
@@ -311,6 +312,7 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 		}
 		// mark the tuples as committed
 		info->version_info->CommitDelete(info->vector_idx, commit_id, info->rows, info->count);
+		info->table->info->last_commit_id = commit_id;
 		break;
 	}
 	case UndoFlags::UPDATE_TUPLE: {
@@ -320,6 +322,7 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 			WriteUpdate(*info);
 		}
 		info->version_number = commit_id;
+		info->segment->column_data.GetTableInfo().last_commit_id = commit_id;
 		break;
 	}
 	default:
@@ -46,6 +46,7 @@ void RequireValueEqual(ConfigurationOption *op, const Value &left, const Value &
 OptionValueSet &GetValueForOption(const string &name) {
 	static unordered_map<string, OptionValueSet> value_map = {
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
+	    {"checkpoint_bloom_filters", {true}},
 	    {"checkpoint_threshold", {"4.0 GiB"}},
 	    {"debug_checkpoint_abort", {{"none", "before_truncate", "before_header", "after_free_list_write"}}},
 	    {"default_collation", {"nocase"}},
@@ -85,12 +86,15 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"integer_division", {true}},
 	    {"extension_directory", {"test"}},
 	    {"immediate_transaction_mode", {true}},
+	    {"index_scan_max_count", {Value::UBIGINT(1000)}},
+	    {"index_scan_percentage", {0.5}},
 	    {"max_expression_depth", {50}},
 	    {"max_memory", {"4.0 GiB"}},
 	    {"memory_limit", {"4.0 GiB"}},
 	    {"ordered_aggregate_threshold", {Value::UBIGINT(idx_t(1) << 12)}},
 	    {"null_order", {"nulls_first"}},
 	    {"perfect_ht_threshold", {0}},
+	    {"pin_threads", {true}},
 	    {"pivot_filter_threshold", {999}},
 	    {"pivot_limit", {999}},
 	    {"partitioned_write_flush_threshold", {123}},
@@ -100,7 +104,9 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"profiling_mode", {"detailed"}},
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
+	    {"result_cache_memory_limit", {"1.0 MiB"}},
 	    {"temp_directory", {"tmp"}},
+	    {"temp_file_compression", {"lz4"}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"worker_threads", {42}},
 	    {"enable_http_metadata_cache", {true}},
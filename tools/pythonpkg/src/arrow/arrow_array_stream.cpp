@@ -6,6 +6,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
@@ -374,6 +375,16 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 
 		return child_expr;
 	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		//! The filter is translated once, use its current constant (if any)
+		auto &dynamic_filter = filter->Cast<DynamicFilter>();
+		auto constant_filter = dynamic_filter.filter_data ? dynamic_filter.filter_data->GetFilter() : nullptr;
+		if (constant_filter) {
+			return TransformFilterRecursive(constant_filter.get(), column_ref, timezone_config, type);
+		}
+		auto constant_field = field(py::tuple(py::cast(column_ref)));
+		return constant_field.attr("is_null")().attr("__or__")(constant_field.attr("is_valid")());
+	}
 	default:
 		throw NotImplementedException("Pushdown Filter Type not supported in Arrow Scans");
 	}